@@ -0,0 +1,214 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_ASSETS
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_assets";
+
+#if LV_COLOR_16_SWAP
+#define ASSETS_FLAGS_EXPECTED   (BSP_ASSETS_FLAG_SWAP)
+#else
+#define ASSETS_FLAGS_EXPECTED   (0)
+#endif
+
+static struct {
+    esp_partition_mmap_handle_t mmap;
+    const uint8_t *base;                // Mapped container, NULL when not mounted
+    uint32_t count;
+    const bsp_assets_entry_t *entries;  // In the mapping, sorted by name
+    lv_img_dsc_t *imgs;                 // Descriptor of every entry, LV_IMG_CF_UNKNOWN for data
+} s_assets;
+
+static esp_err_t bsp_assets_check_header(const bsp_assets_header_t *header, const esp_partition_t *part)
+{
+    if (header->magic != BSP_ASSETS_MAGIC) {
+        ESP_LOGW(TAG, "Nothing packed in partition \"%s\", flash it with idf.py %s-flash", part->label, part->label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (header->version != BSP_ASSETS_VERSION) {
+        ESP_LOGE(TAG, "Assets version %d, expected %d", header->version, BSP_ASSETS_VERSION);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if ((header->flags & BSP_ASSETS_FLAG_SWAP) != ASSETS_FLAGS_EXPECTED) {
+        ESP_LOGE(TAG, "Images were packed for another LV_COLOR_16_SWAP");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (header->size < sizeof(*header) || header->size > part->size ||
+            header->count > (header->size - sizeof(*header)) / sizeof(bsp_assets_entry_t)) {
+        ESP_LOGE(TAG, "%" PRIu32 " entries in %" PRIu32 " B do not fit the %" PRIu32 " B partition", header->count,
+                 header->size, part->size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t bsp_assets_check_entry(const bsp_assets_entry_t *entry, uint32_t data_start, uint32_t size)
+{
+    if (memchr(entry->name, '\0', sizeof(entry->name)) == NULL || entry->offset < data_start ||
+            entry->offset > size || entry->size > size - entry->offset) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return ESP_OK;
+}
+
+static lv_img_cf_t bsp_assets_img_cf(uint8_t type)
+{
+    switch (type) {
+    case BSP_ASSET_IMG_RGB565:
+        return LV_IMG_CF_TRUE_COLOR;
+    case BSP_ASSET_IMG_RGB565A8:
+        return LV_IMG_CF_TRUE_COLOR_ALPHA;
+#if CONFIG_BSP_IMG_RLE
+    case BSP_ASSET_IMG_RLE:
+        return BSP_IMG_CF_RLE;
+#endif
+    default:
+        return LV_IMG_CF_UNKNOWN;   // Data, or an image no decoder can draw
+    }
+}
+
+esp_err_t bsp_assets_mount(void)
+{
+    if (s_assets.base) {
+        return ESP_OK;
+    }
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                  CONFIG_BSP_ASSETS_PARTITION_LABEL);
+    if (part == NULL) {
+        ESP_LOGW(TAG, "No partition \"%s\" in the partition table", CONFIG_BSP_ASSETS_PARTITION_LABEL);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    bsp_assets_header_t header;
+    esp_err_t ret = esp_partition_read(part, 0, &header, sizeof(header));
+    if (ret == ESP_OK) {
+        ret = bsp_assets_check_header(&header, part);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    /* Only the container is mapped, not the unused end of the partition */
+    const void *base = NULL;
+    esp_partition_mmap_handle_t mmap;
+    ret = esp_partition_mmap(part, 0, header.size, ESP_PARTITION_MMAP_DATA, &base, &mmap);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Mapping %" PRIu32 " B failed (%s)", header.size, esp_err_to_name(ret));
+        return ret;
+    }
+
+#if CONFIG_BSP_ASSETS_VERIFY
+    const uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)base + sizeof(header), header.size - sizeof(header));
+    if (crc != header.crc32) {
+        ESP_LOGE(TAG, "CRC 0x%08" PRIx32 ", expected 0x%08" PRIx32, crc, header.crc32);
+        ret = ESP_ERR_INVALID_CRC;
+        goto err;
+    }
+#endif
+
+    const bsp_assets_entry_t *entries = (const bsp_assets_entry_t *)((const uint8_t *)base + sizeof(header));
+    const uint32_t data_start = sizeof(header) + header.count * sizeof(bsp_assets_entry_t);
+    for (uint32_t i = 0; i < header.count; i++) {
+        if (bsp_assets_check_entry(&entries[i], data_start, header.size) != ESP_OK) {
+            ESP_LOGE(TAG, "Entry %" PRIu32 " is corrupted", i);
+            ret = ESP_ERR_INVALID_SIZE;
+            goto err;
+        }
+    }
+
+    /* Descriptors are the only copy, pixels stay in flash */
+    lv_img_dsc_t *imgs = calloc(header.count ? header.count : 1, sizeof(lv_img_dsc_t));
+    if (imgs == NULL) {
+        ret = ESP_ERR_NO_MEM;
+        goto err;
+    }
+    for (uint32_t i = 0; i < header.count; i++) {
+        const lv_img_cf_t cf = bsp_assets_img_cf(entries[i].type);
+        if (cf == LV_IMG_CF_UNKNOWN) {
+            if (entries[i].type != BSP_ASSET_DATA) {
+                ESP_LOGW(TAG, "%s: image format %d is not supported", entries[i].name, entries[i].type);
+            }
+            continue;
+        }
+        imgs[i].header.cf = cf;
+        imgs[i].header.w = entries[i].width;
+        imgs[i].header.h = entries[i].height;
+        imgs[i].data_size = entries[i].size;
+        imgs[i].data = (const uint8_t *)base + entries[i].offset;
+    }
+
+    s_assets.mmap = mmap;
+    s_assets.base = base;
+    s_assets.count = header.count;
+    s_assets.entries = entries;
+    s_assets.imgs = imgs;
+    ESP_LOGI(TAG, "%" PRIu32 " assets, %" PRIu32 " B mapped at %p", header.count, header.size, base);
+    return ESP_OK;
+
+err:
+    esp_partition_munmap(mmap);
+    return ret;
+}
+
+void bsp_assets_unmount(void)
+{
+    if (s_assets.base == NULL) {
+        return;
+    }
+    free(s_assets.imgs);
+    esp_partition_munmap(s_assets.mmap);
+    memset(&s_assets, 0, sizeof(s_assets));
+}
+
+static int bsp_assets_cmp(const void *key, const void *entry)
+{
+    return strncmp(key, ((const bsp_assets_entry_t *)entry)->name, BSP_ASSETS_NAME_LEN);
+}
+
+static const bsp_assets_entry_t *bsp_assets_find(const char *name)
+{
+    if (s_assets.base == NULL || name == NULL) {
+        return NULL;
+    }
+    return bsearch(name, s_assets.entries, s_assets.count, sizeof(bsp_assets_entry_t), bsp_assets_cmp);
+}
+
+const lv_img_dsc_t *bsp_assets_get_img(const char *name)
+{
+    const bsp_assets_entry_t *entry = bsp_assets_find(name);
+    if (entry == NULL) {
+        return NULL;
+    }
+    const lv_img_dsc_t *img = &s_assets.imgs[entry - s_assets.entries];
+    return (img->header.cf != LV_IMG_CF_UNKNOWN) ? img : NULL;
+}
+
+esp_err_t bsp_assets_get_data(const char *name, const void **data, size_t *size)
+{
+    BSP_NULL_CHECK(name, ESP_ERR_INVALID_ARG);
+    BSP_NULL_CHECK(data, ESP_ERR_INVALID_ARG);
+    if (s_assets.base == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const bsp_assets_entry_t *entry = bsp_assets_find(name);
+    if (entry == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    *data = s_assets.base + entry->offset;
+    if (size) {
+        *size = entry->size;
+    }
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_ASSETS
@@ -0,0 +1,595 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_AUDIO
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "driver/i2s_std.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_audio.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_audio";
+
+#define AUDIO_TASK_STACK        (4096)
+#define AUDIO_READER_STACK      (4096)
+#define AUDIO_BUFFERS           (2)
+#define AUDIO_BUFFER_BYTES      (CONFIG_BSP_AUDIO_READ_BUFFER_KB * 1024)
+#define AUDIO_FRAME_BYTES       (4)     // 16 bit stereo
+#define AUDIO_DMA_BUF_BYTES     (CONFIG_BSP_AUDIO_DMA_FRAME_NUM * AUDIO_FRAME_BYTES)
+#define AUDIO_DMA_BYTES         (CONFIG_BSP_AUDIO_DMA_DESC_NUM * AUDIO_DMA_BUF_BYTES)
+#define AUDIO_WRITE_TIMEOUT_MS  (1000)
+#define AUDIO_READER_POLL_MS    (100)
+
+/* Buffer passed between the reader and the I2S task */
+typedef struct {
+    uint8_t *data;                      // DMA capable, so FATFS reads sectors straight into it
+    uint32_t size;
+    uint32_t gen;                       // Playback the data belongs to
+    uint32_t sample_rate;
+    bool last;                          // Last buffer of the file
+} audio_buf_t;
+
+typedef struct {
+    uint32_t gen;
+    bool loop;
+    char path[BSP_AUDIO_PATH_MAX];
+} audio_cmd_t;
+
+static struct {
+    i2s_chan_handle_t tx;
+    QueueHandle_t cmd_q;
+    QueueHandle_t free_q;
+    QueueHandle_t full_q;
+    SemaphoreHandle_t stopped;
+    audio_buf_t bufs[AUDIO_BUFFERS];
+    uint8_t *silence;
+#if CONFIG_BSP_AUDIO_SFX
+    uint8_t *mix;                       // One DMA buffer of output with the effects mixed in
+#endif
+    volatile bool running;
+    uint32_t sample_rate;               // Used by the I2S task only
+    uint32_t tx_gen;                    // Playback of the last buffer written to the DMA, I2S task only
+    uint32_t written;                   // Bytes written to the DMA, I2S task only
+    volatile uint32_t sent;             // Bytes the DMA sent, from the I2S ISR
+    portMUX_TYPE lock;                  // Protects gen, ended and stats
+    uint32_t gen;                       // Incremented by every play and stop
+    uint32_t ended;                     // Playback that ended last, playing while it differs from gen
+    bsp_audio_stats_t stats;
+} s_audio = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static bool IRAM_ATTR audio_on_sent(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    s_audio.sent += event->size;
+    return false;
+}
+
+/* No buffer was written since the DMA sent it, it goes out again cleared by auto_clear */
+static bool IRAM_ATTR audio_on_underrun(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    portENTER_CRITICAL_ISR(&s_audio.lock);
+    s_audio.stats.underruns++;
+    portEXIT_CRITICAL_ISR(&s_audio.lock);
+    return false;
+}
+
+static void audio_count_error(void)
+{
+    portENTER_CRITICAL(&s_audio.lock);
+    s_audio.stats.errors++;
+    portEXIT_CRITICAL(&s_audio.lock);
+}
+
+static inline uint32_t audio_gen(void)
+{
+    portENTER_CRITICAL(&s_audio.lock);
+    const uint32_t gen = s_audio.gen;
+    portEXIT_CRITICAL(&s_audio.lock);
+    return gen;
+}
+
+/* Mark a playback as ended, unless a newer one was started in the meantime */
+static void audio_end(uint32_t gen, bool completed)
+{
+    portENTER_CRITICAL(&s_audio.lock);
+    if (gen == s_audio.gen) {
+        s_audio.ended = gen;
+    }
+    s_audio.stats.streams += completed;
+    portEXIT_CRITICAL(&s_audio.lock);
+}
+
+/*******************************************************************************
+* Reader task
+*******************************************************************************/
+
+static bool audio_read_u32(FILE *f, uint32_t *value)
+{
+    return fread(value, sizeof(*value), 1, f) == 1;
+}
+
+esp_err_t bsp_audio_parse(FILE *f, bsp_audio_format_t *format)
+{
+    uint32_t riff, size, wave;
+    if (!audio_read_u32(f, &riff) || riff != 0x46464952 /* RIFF */ || !audio_read_u32(f, &size) ||
+            !audio_read_u32(f, &wave) || wave != 0x45564157 /* WAVE */) {
+        if (fseek(f, 0, SEEK_END) != 0) {
+            return ESP_FAIL;
+        }
+        format->sample_rate = CONFIG_BSP_AUDIO_SAMPLE_RATE;
+        format->channels = 2;
+        format->data_start = 0;
+        format->data_size = ftell(f);
+        return fseek(f, 0, SEEK_SET) == 0 ? ESP_OK : ESP_FAIL;
+    }
+
+    bool fmt_found = false;
+    uint32_t id, chunk_size;
+    while (audio_read_u32(f, &id) && audio_read_u32(f, &chunk_size)) {
+        if (id == 0x20746D66 /* "fmt " */ && chunk_size >= 16) {
+            struct {
+                uint16_t format;
+                uint16_t channels;
+                uint32_t sample_rate;
+                uint32_t byte_rate;
+                uint16_t block_align;
+                uint16_t bits;
+            } fmt;
+            if (fread(&fmt, sizeof(fmt), 1, f) != 1) {
+                return ESP_FAIL;
+            }
+            /* PCM or WAVE_FORMAT_EXTENSIBLE, whose sub-format is not checked */
+            if ((fmt.format != 1 && fmt.format != 0xFFFE) || fmt.bits != 16 || fmt.channels < 1 ||
+                    fmt.channels > 2) {
+                ESP_LOGE(TAG, "Unsupported WAV format %u, %u bit, %u channels", fmt.format, fmt.bits, fmt.channels);
+                return ESP_ERR_NOT_SUPPORTED;
+            }
+            format->sample_rate = fmt.sample_rate;
+            format->channels = fmt.channels;
+            fmt_found = true;
+            chunk_size -= sizeof(fmt);
+        } else if (id == 0x61746164 /* "data" */) {
+            if (!fmt_found) {
+                return ESP_ERR_NOT_SUPPORTED;
+            }
+            format->data_start = ftell(f);
+            format->data_size = chunk_size;
+            return ESP_OK;
+        }
+        /* Chunks are padded to an even size */
+        if (fseek(f, chunk_size + (chunk_size & 1), SEEK_CUR) != 0) {
+            return ESP_FAIL;
+        }
+    }
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+/* Mono samples were read into the first half of the buffer, duplicate them backwards in place */
+static void audio_mono_to_stereo(uint8_t *data, uint32_t samples)
+{
+    int16_t *pcm = (int16_t *)data;
+    for (uint32_t i = samples; i-- > 0;) {
+        pcm[2 * i + 1] = pcm[i];
+        pcm[2 * i] = pcm[i];
+    }
+}
+
+static void audio_stream(const audio_cmd_t *cmd)
+{
+    FILE *f = fopen(cmd->path, "rb");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Opening %s failed", cmd->path);
+        audio_count_error();
+        audio_end(cmd->gen, false);
+        return;
+    }
+    /* Reads go straight to FATFS, the stdio buffer would only add a copy */
+    setvbuf(f, NULL, _IONBF, 0);
+
+    bsp_audio_format_t format;
+    if (bsp_audio_parse(f, &format) != ESP_OK) {
+        ESP_LOGE(TAG, "%s is not a 16 bit PCM file", cmd->path);
+        fclose(f);
+        audio_count_error();
+        audio_end(cmd->gen, false);
+        return;
+    }
+
+    const uint32_t in_frame = format.channels * sizeof(int16_t);
+    const uint32_t read_size = (AUDIO_BUFFER_BYTES / AUDIO_FRAME_BYTES) * in_frame;
+    uint32_t left = format.data_size - format.data_size % in_frame;
+    while (cmd->gen == audio_gen()) {
+        audio_buf_t *buf;
+        if (xQueueReceive(s_audio.free_q, &buf, pdMS_TO_TICKS(AUDIO_READER_POLL_MS)) != pdTRUE) {
+            continue;
+        }
+        if (cmd->gen != audio_gen()) {
+            xQueueSend(s_audio.free_q, &buf, 0);
+            break;
+        }
+
+        const uint32_t want = LV_MIN(left, read_size);
+        const int64_t start = esp_timer_get_time();
+        uint32_t n = fread(buf->data, 1, want, f);
+        const uint32_t elapsed_us = esp_timer_get_time() - start;
+        const bool error = (n < want) && ferror(f);
+        n -= n % in_frame;
+        left = (n < want) ? 0 : left - n;
+
+        bool last = (left == 0);
+        if (last && cmd->loop && !error && format.data_size >= in_frame) {
+            last = (fseek(f, format.data_start, SEEK_SET) != 0);
+            left = format.data_size - format.data_size % in_frame;
+        }
+        if (format.channels == 1) {
+            audio_mono_to_stereo(buf->data, n / sizeof(int16_t));
+        }
+        buf->size = n / in_frame * AUDIO_FRAME_BYTES;
+        buf->gen = cmd->gen;
+        buf->sample_rate = format.sample_rate;
+        buf->last = last || error;
+
+        portENTER_CRITICAL(&s_audio.lock);
+        s_audio.stats.read_us_max = LV_MAX(s_audio.stats.read_us_max, elapsed_us);
+        s_audio.stats.errors += error;
+        portEXIT_CRITICAL(&s_audio.lock);
+        xQueueSend(s_audio.full_q, &buf, portMAX_DELAY);
+        if (buf->last) {
+            break;
+        }
+    }
+    fclose(f);
+}
+
+static void audio_reader_task(void *arg)
+{
+    audio_cmd_t cmd;
+    while (xQueueReceive(s_audio.cmd_q, &cmd, portMAX_DELAY) == pdTRUE && s_audio.running) {
+        audio_stream(&cmd);
+    }
+    xSemaphoreGive(s_audio.stopped);
+    vTaskDelete(NULL);
+}
+
+/*******************************************************************************
+* I2S task
+*******************************************************************************/
+
+static esp_err_t audio_set_rate(uint32_t sample_rate)
+{
+    const i2s_std_clk_config_t clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(sample_rate);
+    i2s_channel_disable(s_audio.tx);
+    const esp_err_t ret = i2s_channel_reconfig_std_clock(s_audio.tx, &clk_cfg);
+    i2s_channel_enable(s_audio.tx);
+    if (ret == ESP_OK) {
+        s_audio.sample_rate = sample_rate;
+    }
+    portENTER_CRITICAL(&s_audio.lock);
+    s_audio.stats.rate_changes += (ret == ESP_OK);
+    portEXIT_CRITICAL(&s_audio.lock);
+    return ret;
+}
+
+/* Returns the bytes queued in the DMA buffer ahead of data once it was written */
+static uint32_t audio_write(const void *data, size_t size, bool playing)
+{
+    /* After an underrun the DMA sent more than was written, it is empty then */
+    const uint32_t sent = s_audio.sent;
+    if ((int32_t)(s_audio.written - sent) < 0) {
+        s_audio.written = sent;
+    }
+    const uint32_t fill = LV_MIN(s_audio.written - sent, AUDIO_DMA_BYTES);
+    const uint32_t ready = uxQueueMessagesWaiting(s_audio.full_q);
+    portENTER_CRITICAL(&s_audio.lock);
+    s_audio.stats.dma_fill = fill;
+    s_audio.stats.read_buffers = ready;
+    if (playing) {
+        s_audio.stats.dma_fill_min = LV_MIN(s_audio.stats.dma_fill_min, fill);
+        s_audio.stats.read_buffers_min = LV_MIN(s_audio.stats.read_buffers_min, ready);
+    }
+    portEXIT_CRITICAL(&s_audio.lock);
+
+    size_t written = 0;
+    i2s_channel_write(s_audio.tx, data, size, &written, AUDIO_WRITE_TIMEOUT_MS);
+    s_audio.written += written;
+    /* The write waits for room, the DMA sent on meanwhile */
+    const int32_t ahead = (int32_t)(s_audio.written - s_audio.sent) - (int32_t)written;
+    return LV_MAX(ahead, 0);
+}
+
+/* Output goes in pieces of one DMA buffer, so an effect triggered meanwhile is mixed into the next one */
+static void audio_output(const uint8_t *data, size_t size, bool playing)
+{
+    for (size_t offset = 0; offset < size; offset += AUDIO_DMA_BUF_BYTES) {
+        const size_t n = LV_MIN(size - offset, AUDIO_DMA_BUF_BYTES);
+#if CONFIG_BSP_AUDIO_SFX
+        memcpy(s_audio.mix, data + offset, n);
+        bsp_audio_sfx_mix((int16_t *)s_audio.mix, n / AUDIO_FRAME_BYTES, s_audio.sample_rate);
+        const uint32_t ahead = audio_write(s_audio.mix, n, playing);
+        bsp_audio_sfx_written(ahead / AUDIO_FRAME_BYTES * 1000000ULL / s_audio.sample_rate);
+#else
+        audio_write(data + offset, n, playing);
+#endif
+    }
+}
+
+static void audio_i2s_task(void *arg)
+{
+    /* Wait for the reader while the DMA still holds most of its buffer, then fill in silence */
+    const TickType_t wait = LV_MAX(1, pdMS_TO_TICKS((CONFIG_BSP_AUDIO_DMA_DESC_NUM - 1) *
+                                   CONFIG_BSP_AUDIO_DMA_FRAME_NUM * 1000ULL / CONFIG_BSP_AUDIO_SAMPLE_RATE / 2));
+    while (s_audio.running) {
+        portENTER_CRITICAL(&s_audio.lock);
+        const uint32_t gen = s_audio.gen;
+        const bool playing = (s_audio.ended != gen);
+        portEXIT_CRITICAL(&s_audio.lock);
+
+        audio_buf_t *buf;
+        if (xQueueReceive(s_audio.full_q, &buf, playing ? wait : 0) != pdTRUE) {
+            /* Silence before the first buffer of a file is the time to open it, not starvation */
+            if (playing && s_audio.tx_gen == gen) {
+                portENTER_CRITICAL(&s_audio.lock);
+                s_audio.stats.starved++;
+                portEXIT_CRITICAL(&s_audio.lock);
+            }
+            audio_output(s_audio.silence, AUDIO_DMA_BUF_BYTES, false);
+            continue;
+        }
+
+        /* A file started while waiting is newer than gen, so compare with the current generation */
+        if (buf->gen == audio_gen()) {
+            if (buf->sample_rate != s_audio.sample_rate && audio_set_rate(buf->sample_rate) != ESP_OK) {
+                ESP_LOGE(TAG, "Sample rate %" PRIu32 " Hz not supported", buf->sample_rate);
+                audio_count_error();
+                bsp_audio_stop();
+            } else {
+                audio_output(buf->data, buf->size, s_audio.tx_gen == buf->gen);
+                s_audio.tx_gen = buf->gen;
+                portENTER_CRITICAL(&s_audio.lock);
+                s_audio.stats.bytes_played += buf->size;
+                portEXIT_CRITICAL(&s_audio.lock);
+                if (buf->last) {
+                    audio_end(buf->gen, true);
+                }
+            }
+        }
+        /* Data of a stopped file is dropped */
+        xQueueSend(s_audio.free_q, &buf, 0);
+    }
+
+    /* Hand back the buffers, the reader may be waiting for one to notice the stop */
+    audio_buf_t *buf;
+    while (xQueueReceive(s_audio.full_q, &buf, 0) == pdTRUE) {
+        xQueueSend(s_audio.free_q, &buf, 0);
+    }
+    xSemaphoreGive(s_audio.stopped);
+    vTaskDelete(NULL);
+}
+
+/*******************************************************************************
+* Public API
+*******************************************************************************/
+
+esp_err_t bsp_audio_play(const char *path, bool loop)
+{
+    BSP_NULL_CHECK(path, ESP_ERR_INVALID_ARG);
+    if (strlen(path) >= BSP_AUDIO_PATH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_audio.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    audio_cmd_t cmd = { .loop = loop };
+    strlcpy(cmd.path, path, sizeof(cmd.path));
+    portENTER_CRITICAL(&s_audio.lock);
+    cmd.gen = ++s_audio.gen;
+    portEXIT_CRITICAL(&s_audio.lock);
+    /* The reader drops the file it plays as soon as it sees the new generation */
+    xQueueSend(s_audio.cmd_q, &cmd, portMAX_DELAY);
+    return ESP_OK;
+}
+
+esp_err_t bsp_audio_stop(void)
+{
+    if (!s_audio.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    portENTER_CRITICAL(&s_audio.lock);
+    s_audio.ended = ++s_audio.gen;
+    portEXIT_CRITICAL(&s_audio.lock);
+    return ESP_OK;
+}
+
+bool bsp_audio_is_playing(void)
+{
+    portENTER_CRITICAL(&s_audio.lock);
+    const bool playing = (s_audio.ended != s_audio.gen);
+    portEXIT_CRITICAL(&s_audio.lock);
+    return playing;
+}
+
+esp_err_t bsp_audio_get_stats(bsp_audio_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+    portENTER_CRITICAL(&s_audio.lock);
+    *stats = s_audio.stats;
+    portEXIT_CRITICAL(&s_audio.lock);
+    return ESP_OK;
+}
+
+void bsp_audio_reset_stats(void)
+{
+    portENTER_CRITICAL(&s_audio.lock);
+    s_audio.stats = (bsp_audio_stats_t) {
+        .dma_size = AUDIO_DMA_BYTES,
+        .dma_fill_min = UINT32_MAX,
+        .read_buffers_min = UINT32_MAX,
+    };
+    portEXIT_CRITICAL(&s_audio.lock);
+}
+
+static void audio_free(void)
+{
+    if (s_audio.tx) {
+        i2s_del_channel(s_audio.tx);
+        s_audio.tx = NULL;
+    }
+    for (int i = 0; i < AUDIO_BUFFERS; i++) {
+        heap_caps_free(s_audio.bufs[i].data);
+        s_audio.bufs[i].data = NULL;
+    }
+    heap_caps_free(s_audio.silence);
+    s_audio.silence = NULL;
+#if CONFIG_BSP_AUDIO_SFX
+    heap_caps_free(s_audio.mix);
+    s_audio.mix = NULL;
+#endif
+    if (s_audio.cmd_q) {
+        vQueueDelete(s_audio.cmd_q);
+        s_audio.cmd_q = NULL;
+    }
+    if (s_audio.free_q) {
+        vQueueDelete(s_audio.free_q);
+        s_audio.free_q = NULL;
+    }
+    if (s_audio.full_q) {
+        vQueueDelete(s_audio.full_q);
+        s_audio.full_q = NULL;
+    }
+    if (s_audio.stopped) {
+        vSemaphoreDelete(s_audio.stopped);
+        s_audio.stopped = NULL;
+    }
+}
+
+static esp_err_t audio_i2s_init(void)
+{
+    i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(CONFIG_BSP_I2S_NUM, I2S_ROLE_MASTER);
+    chan_cfg.dma_desc_num = CONFIG_BSP_AUDIO_DMA_DESC_NUM;
+    chan_cfg.dma_frame_num = CONFIG_BSP_AUDIO_DMA_FRAME_NUM;
+    chan_cfg.auto_clear = true;         // Underruns play silence rather than the old buffer again
+    BSP_ERROR_CHECK_RETURN_ERR(i2s_new_channel(&chan_cfg, &s_audio.tx, NULL));
+
+    const i2s_std_config_t std_cfg = {
+        .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(CONFIG_BSP_AUDIO_SAMPLE_RATE),
+        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO),
+        .gpio_cfg = {
+            .mclk = I2S_GPIO_UNUSED,
+            .bclk = BSP_I2S_BCLK,
+            .ws = BSP_I2S_LRCK,
+            .dout = BSP_I2S_DOUT,
+            .din = I2S_GPIO_UNUSED,
+        },
+    };
+    BSP_ERROR_CHECK_RETURN_ERR(i2s_channel_init_std_mode(s_audio.tx, &std_cfg));
+
+    const i2s_event_callbacks_t cbs = {
+        .on_sent = audio_on_sent,
+        .on_send_q_ovf = audio_on_underrun,
+    };
+    BSP_ERROR_CHECK_RETURN_ERR(i2s_channel_register_event_callback(s_audio.tx, &cbs, NULL));
+    BSP_ERROR_CHECK_RETURN_ERR(i2s_channel_enable(s_audio.tx));
+    s_audio.sample_rate = CONFIG_BSP_AUDIO_SAMPLE_RATE;
+    return ESP_OK;
+}
+
+esp_err_t bsp_audio_init(void)
+{
+    if (s_audio.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_audio.cmd_q = xQueueCreate(2, sizeof(audio_cmd_t));
+    s_audio.free_q = xQueueCreate(AUDIO_BUFFERS, sizeof(audio_buf_t *));
+    s_audio.full_q = xQueueCreate(AUDIO_BUFFERS, sizeof(audio_buf_t *));
+    s_audio.stopped = xSemaphoreCreateCounting(2, 0);
+    s_audio.silence = heap_caps_calloc(1, AUDIO_DMA_BUF_BYTES, MALLOC_CAP_INTERNAL);
+    bool ok = s_audio.cmd_q && s_audio.free_q && s_audio.full_q && s_audio.stopped && s_audio.silence;
+#if CONFIG_BSP_AUDIO_SFX
+    s_audio.mix = heap_caps_malloc(AUDIO_DMA_BUF_BYTES, MALLOC_CAP_INTERNAL);
+    ok = ok && s_audio.mix;
+#endif
+    for (int i = 0; i < AUDIO_BUFFERS && ok; i++) {
+        s_audio.bufs[i].data = heap_caps_malloc(AUDIO_BUFFER_BYTES, MALLOC_CAP_DMA);
+        ok = (s_audio.bufs[i].data != NULL);
+        audio_buf_t *buf = &s_audio.bufs[i];
+        if (ok) {
+            xQueueSend(s_audio.free_q, &buf, 0);
+        }
+    }
+    if (!ok) {
+        audio_free();
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = audio_i2s_init();
+    if (ret != ESP_OK) {
+        audio_free();
+        return ret;
+    }
+
+    s_audio.written = 0;
+    s_audio.sent = 0;
+    s_audio.tx_gen = s_audio.gen;
+    s_audio.ended = s_audio.gen;
+    bsp_audio_reset_stats();
+#if CONFIG_BSP_AUDIO_SFX
+    bsp_audio_sfx_init();
+#endif
+    s_audio.running = true;
+    if (xTaskCreate(audio_i2s_task, "audio_i2s", AUDIO_TASK_STACK, NULL, CONFIG_BSP_AUDIO_TASK_PRIORITY,
+                    NULL) != pdPASS) {
+        s_audio.running = false;
+#if CONFIG_BSP_AUDIO_SFX
+        bsp_audio_sfx_deinit();
+#endif
+        audio_free();
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreate(audio_reader_task, "audio_rd", AUDIO_READER_STACK, NULL, CONFIG_BSP_AUDIO_READER_PRIORITY,
+                    NULL) != pdPASS) {
+        s_audio.running = false;
+        xSemaphoreTake(s_audio.stopped, portMAX_DELAY);
+#if CONFIG_BSP_AUDIO_SFX
+        bsp_audio_sfx_deinit();
+#endif
+        audio_free();
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "I2S%d: %d x %d frames of DMA buffer, 2 x %d kB read buffers", CONFIG_BSP_I2S_NUM,
+             CONFIG_BSP_AUDIO_DMA_DESC_NUM, CONFIG_BSP_AUDIO_DMA_FRAME_NUM, CONFIG_BSP_AUDIO_READ_BUFFER_KB);
+    return ESP_OK;
+}
+
+esp_err_t bsp_audio_deinit(void)
+{
+    if (!s_audio.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    bsp_audio_stop();
+    s_audio.running = false;
+    /* Wakes the reader when it waits for a command */
+    const audio_cmd_t quit = { 0 };
+    xQueueSend(s_audio.cmd_q, &quit, portMAX_DELAY);
+    xSemaphoreTake(s_audio.stopped, portMAX_DELAY);
+    xSemaphoreTake(s_audio.stopped, portMAX_DELAY);
+#if CONFIG_BSP_AUDIO_SFX
+    bsp_audio_sfx_deinit();
+#endif
+    i2s_channel_disable(s_audio.tx);
+    audio_free();
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_AUDIO
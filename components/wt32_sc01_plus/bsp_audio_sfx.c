@@ -0,0 +1,396 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_AUDIO_SFX
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_audio.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_sfx";
+
+#define SFX_CACHE_BYTES         (CONFIG_BSP_AUDIO_SFX_CACHE_KB * 1024)
+#define SFX_TRIGGERS            (16)    // Trigger queue length, a power of two
+#define SFX_FRAC_BITS           (12)    // Fraction bits of the playback position
+#define SFX_FRAC_MASK           ((1 << SFX_FRAC_BITS) - 1)
+#define SFX_GAIN_ONE            (32768) // Q15
+
+_Static_assert((SFX_TRIGGERS & (SFX_TRIGGERS - 1)) == 0, "SFX_TRIGGERS must be a power of two");
+_Static_assert(SFX_CACHE_BYTES / sizeof(int16_t) <= (UINT32_MAX >> SFX_FRAC_BITS),
+               "Effect positions would overflow");
+
+typedef enum {
+    SFX_FREE,
+    SFX_LOADING,
+    SFX_READY,
+} sfx_state_t;
+
+/* Loaded effects are never freed, so voices and handles stay valid */
+typedef struct {
+    atomic_int state;                   // sfx_state_t, the other fields are valid once SFX_READY
+    char name[BSP_AUDIO_PATH_MAX];
+    int16_t *pcm;                       // Internal RAM
+    uint32_t frames;
+    uint32_t sample_rate;
+    uint16_t channels;
+} sfx_effect_t;
+
+/* Cell of the lock-free trigger queue, seq tells producers and the mixer whose turn it is */
+typedef struct {
+    atomic_uint seq;
+    uint16_t sfx;
+    uint16_t gain;                      // Q15
+    int64_t trigger_us;
+} sfx_trigger_t;
+
+typedef struct {
+    const sfx_effect_t *effect;         // NULL when the voice is free
+    uint32_t pos;                       // Frame position in Q20.12
+    int32_t gain;                       // Q15
+} sfx_voice_t;
+
+static struct {
+    atomic_bool running;
+    atomic_uint head;                   // Next trigger cell, advanced by producers
+    uint32_t tail;                      // Next trigger to start, I2S task only
+    atomic_uint triggers;
+    atomic_uint dropped;
+    sfx_trigger_t queue[SFX_TRIGGERS];
+    sfx_effect_t effects[CONFIG_BSP_AUDIO_SFX_MAX];
+    sfx_voice_t voices[CONFIG_BSP_AUDIO_SFX_VOICES];
+    int64_t started_us[SFX_TRIGGERS];   // Triggers of the effects started by the last mix, I2S task only
+    uint32_t started_count;
+    portMUX_TYPE lock;                  // Protects the cache accounting and stats, never taken by triggers
+    bsp_audio_sfx_stats_t stats;
+} s_sfx = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+/*******************************************************************************
+* Trigger queue
+*******************************************************************************/
+
+static bool sfx_push(uint16_t sfx, uint16_t gain, int64_t trigger_us)
+{
+    uint32_t pos = atomic_load_explicit(&s_sfx.head, memory_order_relaxed);
+    sfx_trigger_t *cell;
+    while (true) {
+        cell = &s_sfx.queue[pos & (SFX_TRIGGERS - 1)];
+        const int32_t diff = (int32_t)(atomic_load_explicit(&cell->seq, memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&s_sfx.head, &pos, pos + 1, memory_order_relaxed,
+                    memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&s_sfx.head, memory_order_relaxed);
+        }
+    }
+    cell->sfx = sfx;
+    cell->gain = gain;
+    cell->trigger_us = trigger_us;
+    atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+    return true;
+}
+
+static bool sfx_pop(sfx_trigger_t *trigger)
+{
+    sfx_trigger_t *cell = &s_sfx.queue[s_sfx.tail & (SFX_TRIGGERS - 1)];
+    if (atomic_load_explicit(&cell->seq, memory_order_acquire) != s_sfx.tail + 1) {
+        return false;
+    }
+    trigger->sfx = cell->sfx;
+    trigger->gain = cell->gain;
+    trigger->trigger_us = cell->trigger_us;
+    atomic_store_explicit(&cell->seq, s_sfx.tail + SFX_TRIGGERS, memory_order_release);
+    s_sfx.tail++;
+    return true;
+}
+
+/*******************************************************************************
+* Mixer, I2S task only
+*******************************************************************************/
+
+/* A free voice, or the one closest to the end of its effect */
+static sfx_voice_t *sfx_voice_get(bool *stolen)
+{
+    sfx_voice_t *best = NULL;
+    uint32_t best_left = UINT32_MAX;
+    for (int i = 0; i < CONFIG_BSP_AUDIO_SFX_VOICES; i++) {
+        sfx_voice_t *voice = &s_sfx.voices[i];
+        if (voice->effect == NULL) {
+            *stolen = false;
+            return voice;
+        }
+        const uint32_t left = voice->effect->frames - (voice->pos >> SFX_FRAC_BITS);
+        if (left < best_left) {
+            best = voice;
+            best_left = left;
+        }
+    }
+    *stolen = true;
+    return best;
+}
+
+static inline int16_t sfx_saturate(int32_t value)
+{
+    return (int16_t)LV_CLAMP(INT16_MIN, value, INT16_MAX);
+}
+
+/* Linear interpolation in Q12 steps the effect at its own rate through the output rate */
+static void sfx_mix_voice(sfx_voice_t *voice, int16_t *out, uint32_t count, uint32_t sample_rate)
+{
+    const sfx_effect_t *effect = voice->effect;
+    const uint32_t step = ((uint64_t)effect->sample_rate << SFX_FRAC_BITS) / sample_rate;
+    const uint32_t right_ch = effect->channels - 1;     // Mono effects play on both channels
+    for (uint32_t i = 0; i < count; i++) {
+        const uint32_t index = voice->pos >> SFX_FRAC_BITS;
+        if (index >= effect->frames) {
+            voice->effect = NULL;
+            return;
+        }
+        const uint32_t next = LV_MIN(index + 1, effect->frames - 1);
+        const int32_t frac = voice->pos & SFX_FRAC_MASK;
+        const int16_t *a = &effect->pcm[index * effect->channels];
+        const int16_t *b = &effect->pcm[next * effect->channels];
+        const int32_t left = a[0] + (((b[0] - a[0]) * frac) >> SFX_FRAC_BITS);
+        const int32_t right = a[right_ch] + (((b[right_ch] - a[right_ch]) * frac) >> SFX_FRAC_BITS);
+        out[2 * i] = sfx_saturate(out[2 * i] + ((left * voice->gain) >> 15));
+        out[2 * i + 1] = sfx_saturate(out[2 * i + 1] + ((right * voice->gain) >> 15));
+        voice->pos += step;
+    }
+    if ((voice->pos >> SFX_FRAC_BITS) >= effect->frames) {
+        voice->effect = NULL;
+    }
+}
+
+void bsp_audio_sfx_mix(int16_t *frames, uint32_t count, uint32_t sample_rate)
+{
+    uint32_t stolen = 0;
+    sfx_trigger_t trigger;
+    /* Bounded, triggers arriving meanwhile wait for the next buffer */
+    while (s_sfx.started_count < SFX_TRIGGERS && sfx_pop(&trigger)) {
+        bool voice_stolen;
+        sfx_voice_t *voice = sfx_voice_get(&voice_stolen);
+        voice->effect = &s_sfx.effects[trigger.sfx];
+        voice->pos = 0;
+        voice->gain = trigger.gain;
+        stolen += voice_stolen;
+        s_sfx.started_us[s_sfx.started_count++] = trigger.trigger_us;
+    }
+
+    uint32_t active = 0;
+    for (int i = 0; i < CONFIG_BSP_AUDIO_SFX_VOICES; i++) {
+        if (s_sfx.voices[i].effect) {
+            active++;
+            sfx_mix_voice(&s_sfx.voices[i], frames, count, sample_rate);
+        }
+    }
+
+    if (active || stolen) {
+        portENTER_CRITICAL(&s_sfx.lock);
+        s_sfx.stats.stolen += stolen;
+        s_sfx.stats.voices_max = LV_MAX(s_sfx.stats.voices_max, active);
+        portEXIT_CRITICAL(&s_sfx.lock);
+    }
+}
+
+void bsp_audio_sfx_written(uint32_t queued_us)
+{
+    if (s_sfx.started_count == 0) {
+        return;
+    }
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_sfx.lock);
+    for (uint32_t i = 0; i < s_sfx.started_count; i++) {
+        /* The effect is heard once the DMA played what was queued ahead of it */
+        const uint32_t latency_us = now - s_sfx.started_us[i] + queued_us;
+        s_sfx.stats.started++;
+        s_sfx.stats.latency_us_total += latency_us;
+        s_sfx.stats.latency_us_max = LV_MAX(s_sfx.stats.latency_us_max, latency_us);
+    }
+    portEXIT_CRITICAL(&s_sfx.lock);
+    s_sfx.started_count = 0;
+}
+
+esp_err_t bsp_audio_sfx_init(void)
+{
+    for (uint32_t i = 0; i < SFX_TRIGGERS; i++) {
+        atomic_store_explicit(&s_sfx.queue[i].seq, i, memory_order_relaxed);
+    }
+    atomic_store(&s_sfx.head, 0);
+    s_sfx.tail = 0;
+    s_sfx.started_count = 0;
+    memset(s_sfx.voices, 0, sizeof(s_sfx.voices));
+    atomic_store(&s_sfx.running, true);
+    return ESP_OK;
+}
+
+void bsp_audio_sfx_deinit(void)
+{
+    atomic_store(&s_sfx.running, false);
+}
+
+/*******************************************************************************
+* Cache
+*******************************************************************************/
+
+static bool sfx_find(const char *name, bsp_audio_sfx_t *ret_sfx)
+{
+    for (int i = 0; i < CONFIG_BSP_AUDIO_SFX_MAX; i++) {
+        const sfx_effect_t *effect = &s_sfx.effects[i];
+        if (atomic_load_explicit(&effect->state, memory_order_acquire) == SFX_READY &&
+                strcmp(effect->name, name) == 0) {
+            portENTER_CRITICAL(&s_sfx.lock);
+            s_sfx.stats.cache_hits++;
+            portEXIT_CRITICAL(&s_sfx.lock);
+            *ret_sfx = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Decode the PCM data of f into a free slot of the cache */
+static esp_err_t sfx_load(const char *name, FILE *f, bsp_audio_sfx_t *ret_sfx)
+{
+    bsp_audio_format_t format;
+    esp_err_t ret = bsp_audio_parse(f, &format);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "%s is not a 16 bit PCM file", name);
+        return ret;
+    }
+    const uint32_t frame_bytes = format.channels * sizeof(int16_t);
+    const uint32_t frames = format.data_size / frame_bytes;
+    const uint32_t size = frames * frame_bytes;
+    if (frames == 0 || format.sample_rate == 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    /* Slot and budget are reserved first, so concurrent loads never overcommit the cache */
+    sfx_effect_t *effect = NULL;
+    portENTER_CRITICAL(&s_sfx.lock);
+    for (int i = 0; i < CONFIG_BSP_AUDIO_SFX_MAX && s_sfx.stats.cache_used + size <= SFX_CACHE_BYTES; i++) {
+        if (atomic_load_explicit(&s_sfx.effects[i].state, memory_order_relaxed) == SFX_FREE) {
+            effect = &s_sfx.effects[i];
+            atomic_store_explicit(&effect->state, SFX_LOADING, memory_order_relaxed);
+            s_sfx.stats.cache_used += size;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_sfx.lock);
+    if (effect == NULL) {
+        ESP_LOGE(TAG, "No room for %s (%" PRIu32 " B) in the effect cache", name, size);
+        return ESP_ERR_NO_MEM;
+    }
+
+    effect->pcm = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (effect->pcm == NULL || fread(effect->pcm, 1, size, f) != size) {
+        ret = (effect->pcm == NULL) ? ESP_ERR_NO_MEM : ESP_FAIL;
+        heap_caps_free(effect->pcm);
+        effect->pcm = NULL;
+        portENTER_CRITICAL(&s_sfx.lock);
+        s_sfx.stats.cache_used -= size;
+        atomic_store_explicit(&effect->state, SFX_FREE, memory_order_relaxed);
+        portEXIT_CRITICAL(&s_sfx.lock);
+        return ret;
+    }
+    strlcpy(effect->name, name, sizeof(effect->name));
+    effect->frames = frames;
+    effect->sample_rate = format.sample_rate;
+    effect->channels = format.channels;
+    atomic_store_explicit(&effect->state, SFX_READY, memory_order_release);
+
+    portENTER_CRITICAL(&s_sfx.lock);
+    s_sfx.stats.effects++;
+    portEXIT_CRITICAL(&s_sfx.lock);
+    *ret_sfx = effect - s_sfx.effects;
+    ESP_LOGI(TAG, "Loaded %s: %" PRIu32 " frames at %" PRIu32 " Hz, %u channels", name, frames,
+             format.sample_rate, format.channels);
+    return ESP_OK;
+}
+
+/*******************************************************************************
+* Public API
+*******************************************************************************/
+
+esp_err_t bsp_audio_sfx_load(const char *path, bsp_audio_sfx_t *ret_sfx)
+{
+    BSP_NULL_CHECK(path, ESP_ERR_INVALID_ARG);
+    BSP_NULL_CHECK(ret_sfx, ESP_ERR_INVALID_ARG);
+    if (strlen(path) >= BSP_AUDIO_PATH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (sfx_find(path, ret_sfx)) {
+        return ESP_OK;
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Opening %s failed", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+    const esp_err_t ret = sfx_load(path, f, ret_sfx);
+    fclose(f);
+    return ret;
+}
+
+esp_err_t bsp_audio_sfx_load_mem(const char *name, const void *data, size_t size, bsp_audio_sfx_t *ret_sfx)
+{
+    BSP_NULL_CHECK(name, ESP_ERR_INVALID_ARG);
+    BSP_NULL_CHECK(data, ESP_ERR_INVALID_ARG);
+    BSP_NULL_CHECK(ret_sfx, ESP_ERR_INVALID_ARG);
+    if (strlen(name) >= BSP_AUDIO_PATH_MAX || size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (sfx_find(name, ret_sfx)) {
+        return ESP_OK;
+    }
+
+    /* The same parser as for files, through a read-only memory stream */
+    FILE *f = fmemopen((void *)data, size, "rb");
+    BSP_NULL_CHECK(f, ESP_ERR_NO_MEM);
+    const esp_err_t ret = sfx_load(name, f, ret_sfx);
+    fclose(f);
+    return ret;
+}
+
+esp_err_t bsp_audio_sfx_play(bsp_audio_sfx_t sfx, int volume)
+{
+    if (sfx < 0 || sfx >= CONFIG_BSP_AUDIO_SFX_MAX ||
+            atomic_load_explicit(&s_sfx.effects[sfx].state, memory_order_acquire) != SFX_READY) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!atomic_load(&s_sfx.running)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const uint16_t gain = LV_CLAMP(0, volume, 100) * SFX_GAIN_ONE / 100;
+    if (!sfx_push(sfx, gain, esp_timer_get_time())) {
+        atomic_fetch_add(&s_sfx.dropped, 1);
+        return ESP_ERR_NO_MEM;
+    }
+    atomic_fetch_add(&s_sfx.triggers, 1);
+    return ESP_OK;
+}
+
+esp_err_t bsp_audio_sfx_get_stats(bsp_audio_sfx_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+    portENTER_CRITICAL(&s_sfx.lock);
+    *stats = s_sfx.stats;
+    portEXIT_CRITICAL(&s_sfx.lock);
+    stats->triggers = atomic_load(&s_sfx.triggers);
+    stats->dropped = atomic_load(&s_sfx.dropped);
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_AUDIO_SFX
@@ -0,0 +1,73 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_BOOT_TIMING
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+
+static const char *TAG = "SC01_Plus_boot";
+
+static struct {
+    portMUX_TYPE lock;
+    bsp_boot_phase_t phases[BSP_BOOT_PHASES_MAX];
+    size_t count;
+} s_boot = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+int bsp_boot_phase_begin(const char *name)
+{
+    const uint32_t now = esp_timer_get_time();
+    int phase = -1;
+    portENTER_CRITICAL(&s_boot.lock);
+    if (s_boot.count < BSP_BOOT_PHASES_MAX) {
+        phase = s_boot.count++;
+        s_boot.phases[phase].name = name;
+        s_boot.phases[phase].start_us = now;
+        s_boot.phases[phase].end_us = 0;
+    }
+    portEXIT_CRITICAL(&s_boot.lock);
+    return phase;
+}
+
+void bsp_boot_phase_end(int phase)
+{
+    const uint32_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_boot.lock);
+    if (phase >= 0 && (size_t)phase < s_boot.count) {
+        s_boot.phases[phase].end_us = now;
+    }
+    portEXIT_CRITICAL(&s_boot.lock);
+}
+
+size_t bsp_boot_get_phases(bsp_boot_phase_t *phases)
+{
+    portENTER_CRITICAL(&s_boot.lock);
+    const size_t count = s_boot.count;
+    memcpy(phases, s_boot.phases, count * sizeof(bsp_boot_phase_t));
+    portEXIT_CRITICAL(&s_boot.lock);
+    return count;
+}
+
+void bsp_boot_report(void)
+{
+    bsp_boot_phase_t phases[BSP_BOOT_PHASES_MAX];
+    const size_t count = bsp_boot_get_phases(phases);
+
+    /* Times are since esp_timer started, i.e. after the bootloader and the ROM */
+    ESP_LOGI(TAG, "Boot phases [ms]");
+    ESP_LOGI(TAG, "  %-16s | start |   end | duration", "phase");
+    for (size_t i = 0; i < count; i++) {
+        const bsp_boot_phase_t *p = &phases[i];
+        if (p->end_us == 0) {
+            ESP_LOGI(TAG, "  %-16s | %5.1f |     - |        -", p->name, p->start_us / 1000.0f);
+            continue;
+        }
+        ESP_LOGI(TAG, "  %-16s | %5.1f | %5.1f | %8.1f", p->name, p->start_us / 1000.0f, p->end_us / 1000.0f,
+                 (p->end_us - p->start_us) / 1000.0f);
+    }
+}
+#endif // CONFIG_BSP_BOOT_TIMING
@@ -0,0 +1,163 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_DISPLAY_BENCHMARK
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_bench";
+
+#define BENCH_BAND_LINES       (40)
+#define BENCH_BAND_PIXELS      (BSP_LCD_H_RES * BENCH_BAND_LINES)
+#define BENCH_FRAME_BYTES      (BSP_LCD_H_RES * BSP_LCD_V_RES * sizeof(uint16_t))
+#define BENCH_TIMEOUT_MS       (1000)
+
+typedef enum {
+    BENCH_PATTERN_SOLID,
+    BENCH_PATTERN_BARS,
+    BENCH_PATTERN_CHECKER,
+    BENCH_PATTERN_MAX,
+} bench_pattern_t;
+
+static const char *bench_pattern_name[BENCH_PATTERN_MAX] = {
+    "solid", "bars", "checker",
+};
+
+static bool bench_trans_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    BaseType_t need_yield = pdFALSE;
+    vTaskNotifyGiveFromISR((TaskHandle_t)user_ctx, &need_yield);
+    return need_yield == pdTRUE;
+}
+
+static void bench_fill(uint16_t *buf, bench_pattern_t pattern)
+{
+    /* RGB565, byte order does not matter for throughput */
+    static const uint16_t bars[] = { 0xFFFF, 0xFFE0, 0x07FF, 0x07E0, 0xF81F, 0xF800, 0x001F, 0x0000 };
+    const size_t bar_width = BSP_LCD_H_RES / (sizeof(bars) / sizeof(bars[0]));
+
+    for (size_t y = 0; y < BENCH_BAND_LINES; y++) {
+        for (size_t x = 0; x < BSP_LCD_H_RES; x++) {
+            uint16_t color;
+            switch (pattern) {
+            case BENCH_PATTERN_BARS:
+                color = bars[x / bar_width];
+                break;
+            case BENCH_PATTERN_CHECKER:
+                color = ((x + y) & 1) ? 0xFFFF : 0x0000;
+                break;
+            default:
+                color = 0x001F;
+                break;
+            }
+            buf[y * BSP_LCD_H_RES + x] = color;
+        }
+    }
+}
+
+/* Send CONFIG_BSP_DISPLAY_BENCHMARK_FRAMES full frames, return time from the first draw to the last transfer done */
+static esp_err_t bench_run_pattern(esp_lcd_panel_handle_t panel, const uint16_t *buf, int64_t *elapsed_us)
+{
+    const size_t bands = BSP_LCD_V_RES / BENCH_BAND_LINES;
+    const size_t transfers = CONFIG_BSP_DISPLAY_BENCHMARK_FRAMES * bands;
+    size_t done = 0;
+
+    ulTaskNotifyTake(pdTRUE, 0);
+    const int64_t start = esp_timer_get_time();
+    for (size_t frame = 0; frame < CONFIG_BSP_DISPLAY_BENCHMARK_FRAMES; frame++) {
+        for (size_t band = 0; band < bands; band++) {
+            const int y = band * BENCH_BAND_LINES;
+            BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_panel_draw_bitmap(panel, 0, y, BSP_LCD_H_RES, y + BENCH_BAND_LINES, buf));
+            done += ulTaskNotifyTake(pdTRUE, 0);
+        }
+    }
+    while (done < transfers) {
+        const uint32_t notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BENCH_TIMEOUT_MS));
+        if (notified == 0) {
+            ESP_LOGE(TAG, "Transfers timed out (%u of %u done)", (unsigned)done, (unsigned)transfers);
+            return ESP_ERR_TIMEOUT;
+        }
+        done += notified;
+    }
+    *elapsed_us = esp_timer_get_time() - start;
+
+    return ESP_OK;
+}
+
+static esp_err_t bench_run_clock(uint32_t pclk_hz, uint16_t *buf, bsp_display_benchmark_result_t *result)
+{
+    const bsp_display_config_t disp_config = {
+        .pclk_hz = pclk_hz,
+        .max_transfer_bytes = BENCH_BAND_PIXELS * sizeof(uint16_t),
+    };
+    esp_lcd_panel_handle_t panel = NULL;
+    esp_lcd_panel_io_handle_t io = NULL;
+    BSP_ERROR_CHECK_RETURN_ERR(bsp_display_new(&disp_config, &panel, &io));
+
+    const esp_lcd_panel_io_callbacks_t cbs = {
+        .on_color_trans_done = bench_trans_done,
+    };
+    esp_err_t ret = esp_lcd_panel_io_register_event_callbacks(io, &cbs, xTaskGetCurrentTaskHandle());
+    bsp_display_backlight_on();
+
+    int64_t total_us = 0;
+    for (bench_pattern_t pattern = 0; pattern < BENCH_PATTERN_MAX && ret == ESP_OK; pattern++) {
+        int64_t elapsed_us = 0;
+        bench_fill(buf, pattern);
+        ret = bench_run_pattern(panel, buf, &elapsed_us);
+        if (ret == ESP_OK) {
+            ESP_LOGD(TAG, "%" PRIu32 " Hz %s: %lld us", pclk_hz, bench_pattern_name[pattern], elapsed_us);
+            total_us += elapsed_us;
+        }
+    }
+
+    if (ret == ESP_OK) {
+        const uint32_t frames = CONFIG_BSP_DISPLAY_BENCHMARK_FRAMES * BENCH_PATTERN_MAX;
+        result->pclk_hz = pclk_hz;
+        result->frame_time_us = total_us / frames;
+        result->throughput_mbps = (float)BENCH_FRAME_BYTES * frames / total_us;
+    }
+
+    bsp_display_backlight_off();
+    esp_err_t del_ret = bsp_display_del(panel, io);
+
+    return (ret != ESP_OK) ? ret : del_ret;
+}
+
+esp_err_t bsp_display_benchmark(const uint32_t *pclk_hz, size_t count, bsp_display_benchmark_result_t *results)
+{
+    BSP_NULL_CHECK(pclk_hz, ESP_ERR_INVALID_ARG);
+
+    /* Same pattern band is sent for the whole frame, so only one band is kept in DMA capable RAM */
+    uint16_t *buf = heap_caps_malloc(BENCH_BAND_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+    BSP_NULL_CHECK(buf, ESP_ERR_NO_MEM);
+
+    esp_err_t ret = ESP_OK;
+    ESP_LOGI(TAG, "Flush benchmark: %dx%d RGB565, %d frames per pattern", BSP_LCD_H_RES, BSP_LCD_V_RES,
+             CONFIG_BSP_DISPLAY_BENCHMARK_FRAMES);
+    ESP_LOGI(TAG, " pclk [kHz] | frame [us] |   fps | MB/s");
+    for (size_t i = 0; i < count; i++) {
+        bsp_display_benchmark_result_t result = { 0 };
+        ret = bench_run_clock(pclk_hz[i], buf, &result);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, " %10" PRIu32 " | failed (%s)", pclk_hz[i] / 1000, esp_err_to_name(ret));
+            break;
+        }
+        ESP_LOGI(TAG, " %10" PRIu32 " | %10" PRIu32 " | %5.1f | %4.1f", pclk_hz[i] / 1000, result.frame_time_us,
+                 1000000.0f / result.frame_time_us, result.throughput_mbps);
+        if (results) {
+            results[i] = result;
+        }
+    }
+
+    heap_caps_free(buf);
+    return ret;
+}
+#endif // CONFIG_BSP_DISPLAY_BENCHMARK
@@ -0,0 +1,321 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_DISPLAY_DRAW_ACCEL
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_random.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "esp_lvgl_port.h"
+#include "bsp_display_draw.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_draw";
+
+/* Shorter rows are faster in C than aligning them for the vector unit */
+#define DRAW_PIE_MIN_PX         (32)
+#define DRAW_PIE_BLOCK_PX       (16 / sizeof(lv_color_t))
+
+/* Odd buffer width, so rows start at every alignment */
+#define SELFTEST_W              (83)
+#define SELFTEST_H              (7)
+#define SELFTEST_CASES          (256)
+
+#if CONFIG_BSP_DISPLAY_DRAW_PIE
+void bsp_display_fill16_pie(lv_color_t *dst, const lv_color_t *color, uint32_t blocks);
+void bsp_display_copy16_pie(lv_color_t *dst, const lv_color_t *src, uint32_t blocks);
+#endif
+
+static struct {
+    lv_disp_t *disp;
+    bool use_pie;       // PIE kernels passed the self-test (or it is disabled)
+} s_draw;
+
+static void LV_ATTRIBUTE_FAST_MEM bsp_display_draw_fill(lv_color_t *dst, lv_color_t color, uint32_t len)
+{
+#if CONFIG_BSP_DISPLAY_DRAW_PIE
+    if (s_draw.use_pie && len >= DRAW_PIE_MIN_PX) {
+        for (; (uintptr_t)dst & 0xF; len--) {
+            *dst++ = color;
+        }
+        const uint32_t blocks = len / DRAW_PIE_BLOCK_PX;
+        bsp_display_fill16_pie(dst, &color, blocks);
+        dst += blocks * DRAW_PIE_BLOCK_PX;
+        len -= blocks * DRAW_PIE_BLOCK_PX;
+    }
+#endif
+    lv_color_fill(dst, color, len);
+}
+
+static void LV_ATTRIBUTE_FAST_MEM bsp_display_draw_copy(lv_color_t *dst, const lv_color_t *src, uint32_t len)
+{
+#if CONFIG_BSP_DISPLAY_DRAW_PIE
+    if (s_draw.use_pie && len >= DRAW_PIE_MIN_PX) {
+        for (; (uintptr_t)dst & 0xF; len--) {
+            *dst++ = *src++;
+        }
+        /* The kernel reads one block ahead of the source, leave the last block to memcpy */
+        const uint32_t blocks = (len - DRAW_PIE_BLOCK_PX) / DRAW_PIE_BLOCK_PX;
+        bsp_display_copy16_pie(dst, src, blocks);
+        dst += blocks * DRAW_PIE_BLOCK_PX;
+        src += blocks * DRAW_PIE_BLOCK_PX;
+        len -= blocks * DRAW_PIE_BLOCK_PX;
+    }
+#endif
+    lv_memcpy(dst, src, len * sizeof(lv_color_t));
+}
+
+/* Number of mask bytes equal to value from the start of mask, 4 bytes at once where aligned */
+static inline uint32_t bsp_display_mask_run(const lv_opa_t *mask, uint32_t len, lv_opa_t value)
+{
+    const uint32_t value32 = value * 0x01010101U;
+    uint32_t n = 0;
+
+    while (n < len && ((uintptr_t)&mask[n] & 0x3) && mask[n] == value) {
+        n++;
+    }
+    if (((uintptr_t)&mask[n] & 0x3) == 0) {
+        while (n + 4 <= len && *(const uint32_t *)&mask[n] == value32) {
+            n += 4;
+        }
+    }
+    while (n < len && mask[n] == value) {
+        n++;
+    }
+    return n;
+}
+
+/*
+ * Masked row: transparent runs are skipped, covered runs go through the fill/copy kernels and
+ * only partly covered pixels are mixed. Anti-aliased edges and images with alpha channel are
+ * mostly made of long transparent and covered runs.
+ */
+static void LV_ATTRIBUTE_FAST_MEM bsp_display_draw_fill_mask(lv_color_t *dst, lv_color_t color,
+        const lv_opa_t *mask, uint32_t len)
+{
+    uint32_t x = 0;
+    while (x < len) {
+        x += bsp_display_mask_run(&mask[x], len - x, LV_OPA_TRANSP);
+        const uint32_t run = bsp_display_mask_run(&mask[x], len - x, LV_OPA_COVER);
+        bsp_display_draw_fill(&dst[x], color, run);
+        x += run;
+        for (; x < len && mask[x] != LV_OPA_TRANSP && mask[x] != LV_OPA_COVER; x++) {
+            dst[x] = lv_color_mix(color, dst[x], mask[x]);
+        }
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM bsp_display_draw_copy_mask(lv_color_t *dst, const lv_color_t *src,
+        const lv_opa_t *mask, uint32_t len)
+{
+    uint32_t x = 0;
+    while (x < len) {
+        x += bsp_display_mask_run(&mask[x], len - x, LV_OPA_TRANSP);
+        const uint32_t run = bsp_display_mask_run(&mask[x], len - x, LV_OPA_COVER);
+        bsp_display_draw_copy(&dst[x], &src[x], run);
+        x += run;
+        for (; x < len && mask[x] != LV_OPA_TRANSP && mask[x] != LV_OPA_COVER; x++) {
+            dst[x] = lv_color_mix(src[x], dst[x], mask[x]);
+        }
+    }
+}
+
+/* Replacement of lv_draw_sw_blend_basic(), the results are identical */
+static void LV_ATTRIBUTE_FAST_MEM bsp_display_draw_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc)
+{
+    const lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+
+    /* Only opaque normal blending straight into the draw buffer is accelerated */
+    if (dsc->opa < LV_OPA_COVER || dsc->blend_mode != LV_BLEND_MODE_NORMAL || dsc->mask_res == LV_DRAW_MASK_RES_TRANSP ||
+            disp->driver->set_px_cb || disp->driver->screen_transp) {
+        lv_draw_sw_blend_basic(draw_ctx, dsc);
+        return;
+    }
+
+    lv_area_t blend_area;
+    if (!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) {
+        return;
+    }
+
+    if (draw_ctx->wait_for_finish) {
+        draw_ctx->wait_for_finish(draw_ctx);
+    }
+
+    const lv_coord_t w = lv_area_get_width(&blend_area);
+    const lv_coord_t h = lv_area_get_height(&blend_area);
+    const lv_coord_t dest_stride = lv_area_get_width(draw_ctx->buf_area);
+    lv_color_t *dest_buf = (lv_color_t *)draw_ctx->buf + dest_stride * (blend_area.y1 - draw_ctx->buf_area->y1) +
+                           (blend_area.x1 - draw_ctx->buf_area->x1);
+
+    const lv_color_t *src_buf = dsc->src_buf;
+    const lv_coord_t src_stride = lv_area_get_width(dsc->blend_area);
+    if (src_buf) {
+        src_buf += src_stride * (blend_area.y1 - dsc->blend_area->y1) + (blend_area.x1 - dsc->blend_area->x1);
+    }
+
+    const lv_opa_t *mask = (dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) ? NULL : dsc->mask_buf;
+    const lv_coord_t mask_stride = mask ? lv_area_get_width(dsc->mask_area) : 0;
+    if (mask) {
+        mask += mask_stride * (blend_area.y1 - dsc->mask_area->y1) + (blend_area.x1 - dsc->mask_area->x1);
+    }
+
+    for (lv_coord_t y = 0; y < h; y++) {
+        if (src_buf == NULL && mask == NULL) {
+            bsp_display_draw_fill(dest_buf, dsc->color, w);
+        } else if (src_buf == NULL) {
+            bsp_display_draw_fill_mask(dest_buf, dsc->color, mask, w);
+            mask += mask_stride;
+        } else if (mask == NULL) {
+            bsp_display_draw_copy(dest_buf, src_buf, w);
+            src_buf += src_stride;
+        } else {
+            bsp_display_draw_copy_mask(dest_buf, src_buf, mask, w);
+            src_buf += src_stride;
+            mask += mask_stride;
+        }
+        dest_buf += dest_stride;
+    }
+}
+
+static inline lv_coord_t selftest_rand(lv_coord_t min, lv_coord_t max)
+{
+    return min + (lv_coord_t)(esp_random() % (uint32_t)(max - min + 1));
+}
+
+/* Mask made of transparent, covered and partly covered runs like the ones LVGL produces */
+static void selftest_fill_mask(lv_opa_t *mask, size_t len)
+{
+    size_t i = 0;
+    while (i < len) {
+        const uint32_t kind = esp_random() % 3;
+        const size_t run = LV_MIN(len - i, (size_t)selftest_rand(1, 40));
+        if (kind == 2) {
+            esp_fill_random(&mask[i], run);
+        } else {
+            memset(&mask[i], kind ? LV_OPA_COVER : LV_OPA_TRANSP, run);
+        }
+        i += run;
+    }
+}
+
+/* Run one random blend through LVGL and the BSP kernels, true when the buffers match */
+static bool selftest_case(lv_color_t *ref, lv_color_t *out, lv_color_t *src, lv_opa_t *mask)
+{
+    lv_area_t buf_area = { .x1 = 0, .y1 = 0, .x2 = SELFTEST_W - 1, .y2 = SELFTEST_H - 1 };
+    lv_area_t blend_area;
+    blend_area.x1 = selftest_rand(-8, SELFTEST_W - 1);
+    blend_area.x2 = selftest_rand(blend_area.x1, SELFTEST_W + 8);
+    blend_area.y1 = selftest_rand(-2, SELFTEST_H - 1);
+    blend_area.y2 = selftest_rand(blend_area.y1, SELFTEST_H + 2);
+    const size_t area_px = lv_area_get_size(&blend_area);
+
+    const uint32_t kind = esp_random();
+    lv_draw_sw_blend_dsc_t dsc = {
+        .blend_area = &blend_area,
+        .src_buf = (kind & 1) ? src : NULL,
+        .mask_buf = (kind & 2) ? mask : NULL,
+        .mask_res = (kind & 4) ? LV_DRAW_MASK_RES_FULL_COVER : LV_DRAW_MASK_RES_CHANGED,
+        .mask_area = &blend_area,
+        .opa = (kind & 8) ? (lv_opa_t)esp_random() : LV_OPA_COVER,
+        .blend_mode = LV_BLEND_MODE_NORMAL,
+    };
+    dsc.color.full = (uint16_t)esp_random();
+    esp_fill_random(src, area_px * sizeof(lv_color_t));
+    selftest_fill_mask(mask, area_px);
+
+    esp_fill_random(ref, SELFTEST_W * SELFTEST_H * sizeof(lv_color_t));
+    memcpy(out, ref, SELFTEST_W * SELFTEST_H * sizeof(lv_color_t));
+
+    lv_draw_sw_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.base_draw.buf_area = &buf_area;
+    ctx.base_draw.clip_area = &buf_area;
+
+    ctx.base_draw.buf = ref;
+    lv_draw_sw_blend_basic(&ctx.base_draw, &dsc);
+    ctx.base_draw.buf = out;
+    bsp_display_draw_blend(&ctx.base_draw, &dsc);
+
+    if (memcmp(ref, out, SELFTEST_W * SELFTEST_H * sizeof(lv_color_t)) != 0) {
+        ESP_LOGE(TAG, "Mismatch: area (%d,%d)-(%d,%d) src %d mask %d opa %d", blend_area.x1, blend_area.y1,
+                 blend_area.x2, blend_area.y2, dsc.src_buf != NULL, dsc.mask_buf != NULL, dsc.opa);
+        return false;
+    }
+    return true;
+}
+
+esp_err_t bsp_display_draw_selftest(void)
+{
+    BSP_NULL_CHECK(s_draw.disp, ESP_ERR_INVALID_STATE);
+
+    /* Blend areas reach over the buffer edges, see selftest_case() */
+    const size_t area_max = (SELFTEST_W + 17) * (SELFTEST_H + 5);
+    const size_t buf_size = SELFTEST_W * SELFTEST_H * sizeof(lv_color_t);
+    lv_color_t *ref = malloc(buf_size);
+    lv_color_t *out = malloc(buf_size);
+    lv_color_t *src = malloc(area_max * sizeof(lv_color_t));
+    lv_opa_t *mask = malloc(area_max);
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    if (ref && out && src && mask) {
+        ret = ESP_OK;
+        bsp_display_lock(0);
+        /* LVGL blend reads the driver of the refreshing display */
+        lv_disp_t *refreshing = _lv_refr_get_disp_refreshing();
+        _lv_refr_set_disp_refreshing(s_draw.disp);
+        for (int i = 0; i < SELFTEST_CASES && ret == ESP_OK; i++) {
+            ret = selftest_case(ref, out, src, mask) ? ESP_OK : ESP_FAIL;
+        }
+        _lv_refr_set_disp_refreshing(refreshing);
+        bsp_display_unlock();
+    }
+
+    free(ref);
+    free(out);
+    free(src);
+    free(mask);
+    return ret;
+}
+
+esp_err_t bsp_display_draw_init(lv_disp_t *disp)
+{
+    BSP_NULL_CHECK(disp, ESP_ERR_INVALID_ARG);
+
+    if (disp->driver->draw_ctx_init != lv_draw_sw_init_ctx) {
+        ESP_LOGW(TAG, "Display does not use the LVGL software renderer, keeping its blend");
+        return ESP_OK;
+    }
+    s_draw.disp = disp;
+    s_draw.use_pie = true;
+
+#if CONFIG_BSP_DISPLAY_DRAW_SELFTEST
+    esp_err_t ret = bsp_display_draw_selftest();
+#if CONFIG_BSP_DISPLAY_DRAW_PIE
+    if (ret == ESP_FAIL) {
+        ESP_LOGE(TAG, "PIE kernels failed the self-test, using scalar kernels");
+        s_draw.use_pie = false;
+        ret = bsp_display_draw_selftest();
+    }
+#endif
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Blend kernels self-test failed (%s), keeping the LVGL blend", esp_err_to_name(ret));
+        return ESP_OK;
+    }
+#endif
+
+    bsp_display_lock(0);
+    lv_draw_sw_ctx_t *draw_ctx = (lv_draw_sw_ctx_t *)disp->driver->draw_ctx;
+    draw_ctx->blend = bsp_display_draw_blend;
+    bsp_display_unlock();
+
+#if CONFIG_BSP_DISPLAY_DRAW_PIE
+    ESP_LOGI(TAG, "Blend kernels installed (%s)", s_draw.use_pie ? "PIE" : "scalar");
+#else
+    ESP_LOGI(TAG, "Blend kernels installed (scalar)");
+#endif
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_DISPLAY_DRAW_ACCEL
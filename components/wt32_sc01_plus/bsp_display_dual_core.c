@@ -0,0 +1,163 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_DISPLAY_DUAL_CORE
+#include <inttypes.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "esp_lvgl_port.h"
+#include "bsp_display_dual_core.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_dual_core";
+
+#define DUAL_CORE_HELPER_CORE       (1 - CONFIG_BSP_DISPLAY_DUAL_CORE_LVGL_CORE)
+#define DUAL_CORE_TASK_STACK        (3072)
+
+static struct {
+    bool enabled;
+    void (*blend)(lv_draw_ctx_t *, const lv_draw_sw_blend_dsc_t *);        // Blend installed before ours
+    void (*helper_blend)(lv_draw_ctx_t *, const lv_draw_sw_blend_dsc_t *);  // Blend of the helper core
+    TaskHandle_t task;
+    SemaphoreHandle_t done;         // Given by the helper when its half is blended
+    /* Job of the helper, written before it is woken and not touched until it is done */
+    lv_draw_sw_ctx_t job_ctx;
+    lv_area_t job_clip;
+    const lv_draw_sw_blend_dsc_t *job_dsc;
+} s_dual;
+
+static void bsp_display_dual_core_task(void *arg)
+{
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        s_dual.helper_blend(&s_dual.job_ctx.base_draw, s_dual.job_dsc);
+        xSemaphoreGive(s_dual.done);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM bsp_display_dual_core_blend(lv_draw_ctx_t *draw_ctx,
+        const lv_draw_sw_blend_dsc_t *dsc)
+{
+    lv_area_t area;
+    if (!_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+        return;
+    }
+    const lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+    if (!s_dual.enabled || lv_area_get_size(&area) < CONFIG_BSP_DISPLAY_DUAL_CORE_MIN_PX ||
+            lv_area_get_height(&area) < 2 || disp->driver->set_px_cb) {
+        s_dual.blend(draw_ctx, dsc);
+        return;
+    }
+
+    /* Rows are independent: the helper blends the lower half, this task the upper one */
+    const lv_coord_t mid = area.y1 + lv_area_get_height(&area) / 2;
+    s_dual.job_ctx = *(lv_draw_sw_ctx_t *)draw_ctx;
+    s_dual.job_clip = area;
+    s_dual.job_clip.y1 = mid;
+    s_dual.job_ctx.base_draw.clip_area = &s_dual.job_clip;
+    s_dual.job_dsc = dsc;
+    xTaskNotifyGive(s_dual.task);
+
+    lv_area_t upper = area;
+    upper.y2 = mid - 1;
+    const lv_area_t *clip_area = draw_ctx->clip_area;
+    draw_ctx->clip_area = &upper;
+    s_dual.blend(draw_ctx, dsc);
+    draw_ctx->clip_area = clip_area;
+
+    /* Both halves must be in the buffer before LVGL draws over them or flushes it */
+    xSemaphoreTake(s_dual.done, portMAX_DELAY);
+}
+
+void bsp_display_dual_core_enable(bool enable)
+{
+    bsp_display_lock(0);
+    s_dual.enabled = enable && s_dual.task;
+    bsp_display_unlock();
+}
+
+bool bsp_display_dual_core_is_enabled(void)
+{
+    return s_dual.enabled;
+}
+
+esp_err_t bsp_display_dual_core_compare(lv_disp_t *disp, uint32_t frames, uint32_t *single_us, uint32_t *dual_us)
+{
+    BSP_NULL_CHECK(disp, ESP_ERR_INVALID_ARG);
+    if (frames == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_dual.task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* Time stands still while the lock is held, both runs render exactly the same frame */
+    uint32_t frame_us[2];
+    bsp_display_lock(0);
+    const bool enabled = s_dual.enabled;
+    for (int dual = 0; dual < 2; dual++) {
+        s_dual.enabled = dual;
+        const int64_t start = esp_timer_get_time();
+        for (uint32_t i = 0; i < frames; i++) {
+            lv_obj_invalidate(lv_disp_get_scr_act(disp));
+            lv_refr_now(disp);
+        }
+        frame_us[dual] = (esp_timer_get_time() - start) / frames;
+    }
+    s_dual.enabled = enabled;
+    bsp_display_unlock();
+
+    ESP_LOGI(TAG, "Full screen refresh: %" PRIu32 " us on one core, %" PRIu32 " us on both (%.2fx)", frame_us[0],
+             frame_us[1], (float)frame_us[0] / frame_us[1]);
+    if (single_us) {
+        *single_us = frame_us[0];
+    }
+    if (dual_us) {
+        *dual_us = frame_us[1];
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_display_dual_core_init(lv_disp_t *disp)
+{
+    BSP_NULL_CHECK(disp, ESP_ERR_INVALID_ARG);
+
+    if (disp->driver->draw_ctx_init != lv_draw_sw_init_ctx) {
+        ESP_LOGW(TAG, "Display does not use the LVGL software renderer, rendering on one core");
+        return ESP_OK;
+    }
+
+    s_dual.done = xSemaphoreCreateBinary();
+    BSP_NULL_CHECK(s_dual.done, ESP_ERR_NO_MEM);
+    if (xTaskCreatePinnedToCore(bsp_display_dual_core_task, "render", DUAL_CORE_TASK_STACK, NULL,
+                                CONFIG_BSP_DISPLAY_DUAL_CORE_TASK_PRIORITY, &s_dual.task,
+                                DUAL_CORE_HELPER_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create render helper task");
+        vSemaphoreDelete(s_dual.done);
+        return ESP_ERR_NO_MEM;
+    }
+
+    bsp_display_lock(0);
+    lv_draw_sw_ctx_t *draw_ctx = (lv_draw_sw_ctx_t *)disp->driver->draw_ctx;
+    s_dual.blend = draw_ctx->blend ? draw_ctx->blend : lv_draw_sw_blend_basic;
+#if CONFIG_BSP_DISPLAY_DRAW_PIE
+    /* The PIE vector registers belong to the LVGL task, the helper blends with the LVGL C code */
+    s_dual.helper_blend = lv_draw_sw_blend_basic;
+#else
+    s_dual.helper_blend = s_dual.blend;
+#endif
+    draw_ctx->blend = bsp_display_dual_core_blend;
+    s_dual.enabled = true;
+    bsp_display_unlock();
+
+    ESP_LOGI(TAG, "Blends of %d px and more are split between cores %d and %d", CONFIG_BSP_DISPLAY_DUAL_CORE_MIN_PX,
+             CONFIG_BSP_DISPLAY_DUAL_CORE_LVGL_CORE, DUAL_CORE_HELPER_CORE);
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_DISPLAY_DUAL_CORE
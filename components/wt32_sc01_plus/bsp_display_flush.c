@@ -0,0 +1,765 @@
+#include <stdatomic.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "driver/gpio.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_lcd_panel_commands.h"
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
+#endif
+
+#include "bsp/wt32_sc01_plus.h"
+#include "esp_lvgl_port.h"
+#include "bsp_display_flush.h"
+#include "bsp_display_latency.h"
+#include "bsp_display_timing.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_flush";
+
+/* Bus bytes of the CASET, RASET and RAMWR sequence that opens every area on the panel */
+#define LCD_AREA_CMD_BYTES     (3 + 4 + 4)
+
+typedef struct {
+    lv_coord_t y1;
+    lv_coord_t y2;
+} bsp_display_span_t;
+
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+#define FLUSH_PIPE_DEPTH        CONFIG_BSP_DISPLAY_FLUSH_PIPELINE_DEPTH
+#define FLUSH_PIPE_HEAD         SIZE_MAX    // Slot index of the oldest band on the bus
+#define FLUSH_TASK_STACK        (3072)
+
+/* Rendered band handed from the LVGL task to the flush task */
+typedef struct {
+    lv_area_t area;
+    lv_color_t *buf;
+    bool frame_start;       // First band of a refresh, the bus may idle before it
+    bool last;              // Last band of a refresh
+    bool borrowed;          // Buffer belongs to LVGL (software rotation), release it with lv_disp_flush_ready()
+} bsp_display_band_t;
+
+/* Band on the bus, transfers complete in the order they were queued */
+typedef struct {
+    lv_color_t *buf;
+    bool last;
+    bool borrowed;
+    uint32_t pending;       // Transfers left before the buffer is free, plus one while the flush task queues them
+} bsp_display_band_slot_t;
+#endif
+
+static struct {
+    lv_disp_t *disp;
+    esp_lcd_panel_io_handle_t io;
+    esp_lcd_panel_handle_t panel;
+    size_t max_transfer_bytes;
+    atomic_uint trans_pending;  // Panel transfers left before the LVGL buffer can be released
+#if CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+    SemaphoreHandle_t te_sem;   // Given on every TE rising edge (start of V-blank)
+#endif
+#if CONFIG_BSP_DISPLAY_FLUSH_COALESCE
+    lv_timer_cb_t refr_timer_cb;    // Original LVGL refresh timer callback
+#endif
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+    struct {
+        TaskHandle_t task;          // NULL when the pipeline is not running
+        QueueHandle_t bands;        // Rendered bands waiting for the bus
+        QueueHandle_t free_bufs;    // Band buffers LVGL may render into
+        SemaphoreHandle_t drained;  // Given when the last queued band is done
+        lv_color_t *bufs[FLUSH_PIPE_DEPTH];
+        size_t buf_cnt;
+        bool frame_start;           // Next flush opens a new refresh, LVGL task only
+        atomic_uint queued;         // Bands queued and not done yet
+        /* Bands on the bus, the flush task fills the tail and whoever completes the head retires it */
+        portMUX_TYPE lock;          // Protects the slots and the bus state below, taken by the flush task and the ISR
+        bsp_display_band_slot_t slots[FLUSH_PIPE_DEPTH];
+        size_t head;
+        size_t tail;
+        uint32_t on_bus;
+        int64_t idle_since_us;      // Time the bus ran out of bands
+        uint32_t bus_starved;
+        uint64_t bus_idle_us;
+    } pipe;
+#endif
+    bsp_display_flush_stats_t stats;
+} s_flush = {
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+    .pipe.lock = portMUX_INITIALIZER_UNLOCKED,
+#endif
+};
+
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+/* Take the band at the head of the bus off it once all its transfers are done */
+static bool bsp_display_pipe_pop(bsp_display_band_slot_t *retired)
+{
+    bool popped = false;
+    portENTER_CRITICAL_SAFE(&s_flush.pipe.lock);
+    const bsp_display_band_slot_t *slot = &s_flush.pipe.slots[s_flush.pipe.head];
+    if (s_flush.pipe.on_bus > 0 && slot->pending == 0) {
+        /* Copied out, the slot may be refilled as soon as its buffer is released */
+        *retired = *slot;
+        s_flush.pipe.head = (s_flush.pipe.head + 1) % FLUSH_PIPE_DEPTH;
+        if (--s_flush.pipe.on_bus == 0) {
+            s_flush.pipe.idle_since_us = esp_timer_get_time();
+        }
+        popped = true;
+    }
+    portEXIT_CRITICAL_SAFE(&s_flush.pipe.lock);
+    return popped;
+}
+
+/* Release the buffer of a band that left the bus */
+static bool bsp_display_pipe_retire(const bsp_display_band_slot_t *slot, bool in_isr)
+{
+    BaseType_t need_yield = pdFALSE;
+    if (atomic_fetch_sub(&s_flush.pipe.queued, 1) == 1) {
+        if (in_isr) {
+            xSemaphoreGiveFromISR(s_flush.pipe.drained, &need_yield);
+        } else {
+            xSemaphoreGive(s_flush.pipe.drained);
+        }
+    }
+#if CONFIG_BSP_DISPLAY_LATENCY
+    /* Earlier bands may still be on the bus when LVGL flushes the last one */
+    if (slot->last) {
+        bsp_display_latency_flush_done();
+    }
+#endif
+
+    if (slot->borrowed) {
+        lv_disp_flush_ready(s_flush.disp->driver);
+    } else if (in_isr) {
+        xQueueSendFromISR(s_flush.pipe.free_bufs, &slot->buf, &need_yield);
+    } else {
+        /* The queue has room for every band buffer */
+        xQueueSend(s_flush.pipe.free_bufs, &slot->buf, 0);
+    }
+    return need_yield == pdTRUE;
+}
+
+/* Count transfers of the band in slot index (or at the head) as done, and retire the complete bands at the head */
+static bool bsp_display_pipe_done(size_t index, uint32_t count, bool in_isr)
+{
+    portENTER_CRITICAL_SAFE(&s_flush.pipe.lock);
+    s_flush.pipe.slots[index == FLUSH_PIPE_HEAD ? s_flush.pipe.head : index].pending -= count;
+    portEXIT_CRITICAL_SAFE(&s_flush.pipe.lock);
+
+    bool need_yield = false;
+    bsp_display_band_slot_t slot;
+    while (bsp_display_pipe_pop(&slot)) {
+        need_yield |= bsp_display_pipe_retire(&slot, in_isr);
+    }
+    return need_yield;
+}
+#endif
+
+/* Hand the draw buffer back to LVGL once everything flushed from it is on the panel */
+static void bsp_display_flush_done(void)
+{
+#if CONFIG_BSP_DISPLAY_LATENCY
+    bsp_display_latency_flush_done();
+#endif
+#if CONFIG_BSP_DISPLAY_TIMING
+    bsp_display_timing_flush_done();
+#endif
+    lv_disp_flush_ready(s_flush.disp->driver);
+}
+
+/* Count transfers of the current LVGL flush as done, done ones from the ISR or failed ones from the LVGL task */
+static void bsp_display_trans_done(uint32_t count)
+{
+    if (count > 0 && atomic_fetch_sub(&s_flush.trans_pending, count) == count) {
+        bsp_display_flush_done();
+    }
+}
+
+static bool bsp_display_flush_trans_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+    if (s_flush.pipe.task) {
+        /* Transfers complete in order, this one belongs to the oldest band on the bus */
+        return bsp_display_pipe_done(FLUSH_PIPE_HEAD, 1, true);
+    }
+#endif
+    bsp_display_trans_done(1);
+    return false;
+}
+
+/* Number of whole rows of the given width that fit into one transfer */
+static lv_coord_t bsp_display_chunk_rows(lv_coord_t width)
+{
+    const size_t rows = s_flush.max_transfer_bytes / (width * sizeof(lv_color_t));
+    return rows > 0 ? rows : 1;
+}
+
+/* Number of transfers bsp_display_draw() issues for the area */
+static size_t bsp_display_chunk_count(lv_coord_t width, lv_coord_t height)
+{
+    const lv_coord_t rows = bsp_display_chunk_rows(width);
+    return (height + rows - 1) / rows;
+}
+
+/* Count the transfers and bytes bsp_display_draw() will issue for the area */
+static void bsp_display_count(lv_coord_t width, lv_coord_t height)
+{
+    s_flush.stats.transfers += bsp_display_chunk_count(width, height);
+    s_flush.stats.pixel_bytes += width * height * sizeof(lv_color_t);
+}
+
+/*
+ * Send a contiguous area, split into row chunks that fit max_transfer_bytes of the bus. Returns the
+ * chunks that failed: no transfer done event comes for them, the caller counts them as done.
+ */
+static uint32_t bsp_display_draw(int x_start, int y_start, int x_end, int y_end, const lv_color_t *color_data)
+{
+    const lv_coord_t width = x_end - x_start;
+    const lv_coord_t rows = bsp_display_chunk_rows(width);
+
+    uint32_t failed = 0;
+    for (int y = y_start; y < y_end; y += rows) {
+        const int y_chunk_end = LV_MIN(y + rows, y_end);
+        esp_err_t ret = esp_lcd_panel_draw_bitmap(s_flush.panel, x_start, y, x_end, y_chunk_end,
+                        color_data + (y - y_start) * width);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Draw bitmap failed (%s)", esp_err_to_name(ret));
+            failed++;
+        }
+    }
+    return failed;
+}
+
+#if CONFIG_BSP_DISPLAY_FLUSH_COALESCE
+/*
+ * Merge invalidated areas whose bounding box costs at most CONFIG_BSP_DISPLAY_FLUSH_MERGE_COST extra
+ * bus bytes. LVGL joins only areas whose bounding box adds no pixels at all, so small scattered
+ * updates would each pay the command and transaction overhead.
+ */
+#define COALESCE_NO_GROUP       UINT8_MAX
+
+/* Invalidated areas as LVGL reported them, and the merged area each one ended up in */
+static lv_area_t s_inv_orig[LV_INV_BUF_SIZE];
+static uint8_t s_inv_group[LV_INV_BUF_SIZE];
+
+/* Pixels of the union of the original areas in groups a and b, overlaps counted once */
+static uint32_t bsp_display_union_size(uint16_t cnt, uint8_t a, uint8_t b)
+{
+    lv_coord_t edges[2 * LV_INV_BUF_SIZE];
+    size_t edge_cnt = 0;
+    for (uint16_t i = 0; i < cnt; i++) {
+        if (s_inv_group[i] != a && s_inv_group[i] != b) {
+            continue;
+        }
+        const lv_coord_t ys[2] = { s_inv_orig[i].y1, s_inv_orig[i].y2 + 1 };
+        for (size_t k = 0; k < 2; k++) {
+            size_t pos = edge_cnt++;
+            while (pos > 0 && edges[pos - 1] > ys[k]) {
+                edges[pos] = edges[pos - 1];
+                pos--;
+            }
+            edges[pos] = ys[k];
+        }
+    }
+
+    /* Rows between two edges are covered by the same areas, add up their merged x ranges */
+    uint32_t size = 0;
+    for (size_t e = 0; e + 1 < edge_cnt; e++) {
+        const lv_coord_t y = edges[e];
+        if (edges[e + 1] == y) {
+            continue;
+        }
+        lv_area_t xs[LV_INV_BUF_SIZE];
+        size_t x_cnt = 0;
+        for (uint16_t i = 0; i < cnt; i++) {
+            const lv_area_t *orig = &s_inv_orig[i];
+            if ((s_inv_group[i] != a && s_inv_group[i] != b) || orig->y1 > y || orig->y2 < y) {
+                continue;
+            }
+            size_t pos = x_cnt++;
+            while (pos > 0 && xs[pos - 1].x1 > orig->x1) {
+                xs[pos] = xs[pos - 1];
+                pos--;
+            }
+            xs[pos] = *orig;
+        }
+        uint32_t width = 0;
+        lv_coord_t end = LV_COORD_MIN;
+        for (size_t k = 0; k < x_cnt; k++) {
+            const lv_coord_t start = LV_MAX(xs[k].x1, end);
+            if (xs[k].x2 + 1 > start) {
+                width += xs[k].x2 + 1 - start;
+                end = xs[k].x2 + 1;
+            }
+        }
+        size += width * (edges[e + 1] - y);
+    }
+    return size;
+}
+
+static void bsp_display_coalesce(lv_disp_t *disp)
+{
+    /* Pixels really invalidated in every area, a merged box may only exceed them by the merge cost */
+    static uint32_t covered[LV_INV_BUF_SIZE];
+    uint32_t areas = 0;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        areas += disp->inv_area_joined[i] ? 0 : 1;
+        covered[i] = lv_area_get_size(&disp->inv_areas[i]);
+        s_inv_orig[i] = disp->inv_areas[i];
+        s_inv_group[i] = disp->inv_area_joined[i] ? COALESCE_NO_GROUP : i;
+    }
+    s_flush.stats.areas_in += areas;
+
+    bool merged;
+    do {
+        merged = false;
+        for (uint16_t i = 0; i < disp->inv_p; i++) {
+            if (disp->inv_area_joined[i]) {
+                continue;
+            }
+            for (uint16_t j = i + 1; j < disp->inv_p; j++) {
+                if (disp->inv_area_joined[j]) {
+                    continue;
+                }
+                lv_area_t joined;
+                _lv_area_join(&joined, &disp->inv_areas[i], &disp->inv_areas[j]);
+                /* Against the invalidated pixels, not the boxes, so overdraw never accumulates over merges.
+                 * The sum is the cheap bound, only pairs that pass it pay for the union of overlapping areas. */
+                const int64_t joined_size = lv_area_get_size(&joined);
+                if ((joined_size - covered[i] - covered[j]) * (int64_t)sizeof(lv_color_t) >
+                        CONFIG_BSP_DISPLAY_FLUSH_MERGE_COST) {
+                    continue;
+                }
+                const uint32_t union_size = bsp_display_union_size(disp->inv_p, i, j);
+                if ((joined_size - union_size) * (int64_t)sizeof(lv_color_t) > CONFIG_BSP_DISPLAY_FLUSH_MERGE_COST) {
+                    continue;
+                }
+                const int64_t grown = joined_size - lv_area_get_size(&disp->inv_areas[i]) -
+                                      lv_area_get_size(&disp->inv_areas[j]);
+                lv_area_copy(&disp->inv_areas[i], &joined);
+                covered[i] = union_size;
+                for (uint16_t k = 0; k < disp->inv_p; k++) {
+                    s_inv_group[k] = (s_inv_group[k] == j) ? i : s_inv_group[k];
+                }
+                disp->inv_area_joined[j] = 1;
+                s_flush.stats.overdraw_bytes += grown > 0 ? grown * sizeof(lv_color_t) : 0;
+                s_flush.stats.cmd_bytes_saved += LCD_AREA_CMD_BYTES;
+                areas--;
+                merged = true;
+            }
+        }
+    } while (merged);
+
+    s_flush.stats.areas_out += areas;
+}
+
+static void bsp_display_refr_timer_cb(lv_timer_t *timer)
+{
+    lv_disp_t *disp = timer->user_data;
+
+    /* Layout updates may invalidate more areas, let them happen before coalescing */
+    if (disp->act_scr) {
+        lv_obj_update_layout(disp->act_scr);
+        if (disp->prev_scr) {
+            lv_obj_update_layout(disp->prev_scr);
+        }
+        lv_obj_update_layout(disp->top_layer);
+        lv_obj_update_layout(disp->sys_layer);
+    }
+    if (disp->inv_p > 0) {
+        bsp_display_coalesce(disp);
+    }
+    s_flush.refr_timer_cb(timer);
+}
+#endif // CONFIG_BSP_DISPLAY_FLUSH_COALESCE
+
+#if CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+static void IRAM_ATTR bsp_display_te_isr(void *arg)
+{
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR(s_flush.te_sem, &need_yield);
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void bsp_display_wait_te(void)
+{
+    // Drop an edge latched while rendering, the panel is already scanning that frame
+    xSemaphoreTake(s_flush.te_sem, 0);
+    if (xSemaphoreTake(s_flush.te_sem, pdMS_TO_TICKS(CONFIG_BSP_DISPLAY_TE_TIMEOUT_MS)) != pdTRUE) {
+        ESP_LOGD(TAG, "TE timeout");
+    }
+}
+
+static esp_err_t bsp_display_te_init(esp_lcd_panel_io_handle_t io)
+{
+    s_flush.te_sem = xSemaphoreCreateBinary();
+    BSP_NULL_CHECK(s_flush.te_sem, ESP_ERR_NO_MEM);
+
+    /* Tearing effect line on, V-blanking information only */
+    const uint8_t te_mode = 0x00;
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_panel_io_tx_param(io, LCD_CMD_TEON, &te_mode, 1));
+
+    const gpio_config_t te_conf = {
+        .pin_bit_mask = BIT64(BSP_LCD_TE),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_POSEDGE,
+    };
+    BSP_ERROR_CHECK_RETURN_ERR(gpio_config(&te_conf));
+
+    /* The ISR service may already be installed by another driver */
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_ERR_INVALID_STATE) {
+        BSP_ERROR_CHECK_RETURN_ERR(ret);
+    }
+    BSP_ERROR_CHECK_RETURN_ERR(gpio_isr_handler_add(BSP_LCD_TE, bsp_display_te_isr, NULL));
+
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+
+#if CONFIG_BSP_DISPLAY_LVGL_DIRECT_MODE
+/* Collect row spans touched by the invalidated areas of this refresh, sorted and merged */
+static size_t bsp_display_dirty_spans(lv_disp_t *disp, bsp_display_span_t *spans)
+{
+    size_t cnt = 0;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) {
+            continue;
+        }
+        const lv_area_t *a = &disp->inv_areas[i];
+        size_t pos = cnt;
+        while (pos > 0 && spans[pos - 1].y1 > a->y1) {
+            spans[pos] = spans[pos - 1];
+            pos--;
+        }
+        spans[pos].y1 = a->y1;
+        spans[pos].y2 = a->y2;
+        cnt++;
+    }
+
+    size_t merged = 0;
+    for (size_t i = 0; i < cnt; i++) {
+        if (merged > 0 && spans[i].y1 <= spans[merged - 1].y2 + 1) {
+            spans[merged - 1].y2 = LV_MAX(spans[merged - 1].y2, spans[i].y2);
+        } else {
+            spans[merged++] = spans[i];
+        }
+    }
+    return merged;
+}
+
+static void bsp_display_flush_direct(lv_disp_drv_t *drv, lv_color_t *color_map)
+{
+    /* Every area is rendered into the full-frame buffer, send them together with the last one */
+    if (!lv_disp_flush_is_last(drv)) {
+        lv_disp_flush_ready(drv);
+        return;
+    }
+
+    lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+    const lv_coord_t hor_res = lv_disp_get_hor_res(disp);
+    bsp_display_span_t spans[LV_INV_BUF_SIZE];
+    const size_t span_cnt = bsp_display_dirty_spans(disp, spans);
+    if (span_cnt == 0) {
+        bsp_display_flush_done();
+        return;
+    }
+
+    /* Whole rows are contiguous in the frame buffer, so each span is one area on the panel */
+    size_t transfers = 0;
+    for (size_t i = 0; i < span_cnt; i++) {
+        transfers += bsp_display_chunk_count(hor_res, spans[i].y2 - spans[i].y1 + 1);
+    }
+    bsp_display_wait_te();
+    atomic_store(&s_flush.trans_pending, transfers);
+    uint32_t failed = 0;
+    for (size_t i = 0; i < span_cnt; i++) {
+        bsp_display_count(hor_res, spans[i].y2 - spans[i].y1 + 1);
+        failed += bsp_display_draw(0, spans[i].y1, hor_res, spans[i].y2 + 1, color_map + spans[i].y1 * hor_res);
+    }
+    bsp_display_trans_done(failed);
+    /* LVGL copies the areas into the other buffer before it renders the next frame (refr_sync_areas) */
+}
+#endif // CONFIG_BSP_DISPLAY_LVGL_DIRECT_MODE
+
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+static void bsp_display_flush_task(void *arg)
+{
+    bsp_display_band_t band;
+    while (true) {
+        xQueueReceive(s_flush.pipe.bands, &band, portMAX_DELAY);
+        const lv_coord_t width = lv_area_get_width(&band.area);
+        const lv_coord_t height = lv_area_get_height(&band.area);
+
+        /* The slot is complete before the first transfer can finish. The extra count keeps the band on
+         * the bus until all its chunks are issued, failed ones are then counted against it, not the head */
+        portENTER_CRITICAL(&s_flush.pipe.lock);
+        const size_t index = s_flush.pipe.tail;
+        s_flush.pipe.slots[index] = (bsp_display_band_slot_t) {
+            .buf = band.buf,
+            .last = band.last,
+            .borrowed = band.borrowed,
+            .pending = bsp_display_chunk_count(width, height) + 1,
+        };
+        s_flush.pipe.tail = (s_flush.pipe.tail + 1) % FLUSH_PIPE_DEPTH;
+        if (s_flush.pipe.on_bus++ == 0 && !band.frame_start) {
+            s_flush.pipe.bus_starved++;
+            s_flush.pipe.bus_idle_us += esp_timer_get_time() - s_flush.pipe.idle_since_us;
+        }
+        portEXIT_CRITICAL(&s_flush.pipe.lock);
+
+        /* Blocks only while the panel IO transaction queue is full */
+        const uint32_t failed = bsp_display_draw(band.area.x1, band.area.y1, band.area.x2 + 1, band.area.y2 + 1,
+                                band.buf);
+        bsp_display_pipe_done(index, failed + 1, false);
+    }
+}
+
+static void bsp_display_flush_pipelined(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+    /* Rotating by 90 or 270 degrees, LVGL turns the first square of the band in place in buf_act and goes on
+     * rotating the rest of buf_act into its rotation buffer, so no chunk of it may be handed on */
+    const bool rotating = drv->sw_rotate && (drv->rotated == LV_DISP_ROT_90 || drv->rotated == LV_DISP_ROT_270);
+    const bsp_display_band_t band = {
+        .area = *area,
+        .buf = color_map,
+        .frame_start = s_flush.pipe.frame_start,
+        .last = lv_disp_flush_is_last(drv),
+        .borrowed = rotating || color_map != draw_buf->buf_act,
+    };
+    s_flush.pipe.frame_start = band.last;
+
+    /* A queued band always owns a buffer, so the queue has room for every band */
+    atomic_fetch_add(&s_flush.pipe.queued, 1);
+    xQueueSend(s_flush.pipe.bands, &band, portMAX_DELAY);
+    s_flush.stats.bands++;
+
+    if (band.borrowed) {
+        /* LVGL reuses the band or its rotation buffer after the flush is ready, keep rendering into the same band */
+        if (draw_buf->buf_act == draw_buf->buf1) {
+            draw_buf->buf2 = draw_buf->buf_act;
+        } else {
+            draw_buf->buf1 = draw_buf->buf_act;
+        }
+        return;
+    }
+
+    lv_color_t *next;
+    if (xQueueReceive(s_flush.pipe.free_bufs, &next, 0) != pdTRUE) {
+        const int64_t start = esp_timer_get_time();
+        xQueueReceive(s_flush.pipe.free_bufs, &next, portMAX_DELAY);
+        s_flush.stats.render_stalls++;
+        s_flush.stats.render_stall_us += esp_timer_get_time() - start;
+    }
+    const uint32_t occupancy = s_flush.pipe.buf_cnt - 1 - uxQueueMessagesWaiting(s_flush.pipe.free_bufs);
+    s_flush.stats.band_occupancy_sum += occupancy;
+    s_flush.stats.band_occupancy_max = LV_MAX(s_flush.stats.band_occupancy_max, occupancy);
+
+    /* LVGL swaps buf_act between buf1 and buf2 after the flush, make it land on the free buffer */
+    if (draw_buf->buf_act == draw_buf->buf1) {
+        draw_buf->buf2 = next;
+    } else {
+        draw_buf->buf1 = next;
+    }
+    lv_disp_flush_ready(drv);
+}
+
+void bsp_display_flush_drain(void)
+{
+    if (s_flush.pipe.task == NULL) {
+        return;
+    }
+    /* The lock holder queues no bands, so the count only goes down. Drop a give left by an earlier frame */
+    xSemaphoreTake(s_flush.pipe.drained, 0);
+    while (atomic_load(&s_flush.pipe.queued) > 0) {
+        xSemaphoreTake(s_flush.pipe.drained, portMAX_DELAY);
+    }
+}
+
+static esp_err_t bsp_display_pipe_init(lv_disp_t *disp)
+{
+    lv_disp_draw_buf_t *draw_buf = disp->driver->draw_buf;
+    if (draw_buf->buf2 == NULL) {
+        ESP_LOGW(TAG, "Flush pipeline needs two draw buffers, flushing bands one by one");
+        return ESP_OK;
+    }
+
+    /* Extra buffers come from the same memory as the ones esp_lvgl_port allocated */
+    const size_t buf_bytes = draw_buf->size * sizeof(lv_color_t);
+    const uint32_t caps = esp_ptr_external_ram(draw_buf->buf1) ? MALLOC_CAP_SPIRAM :
+                          (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    s_flush.pipe.bufs[0] = draw_buf->buf1;
+    s_flush.pipe.bufs[1] = draw_buf->buf2;
+    s_flush.pipe.buf_cnt = 2;
+    while (s_flush.pipe.buf_cnt < FLUSH_PIPE_DEPTH) {
+        lv_color_t *buf = heap_caps_malloc(buf_bytes, caps);
+        if (buf == NULL) {
+            ESP_LOGW(TAG, "Only %u of %d band buffers fit", (unsigned)s_flush.pipe.buf_cnt, FLUSH_PIPE_DEPTH);
+            break;
+        }
+        s_flush.pipe.bufs[s_flush.pipe.buf_cnt++] = buf;
+    }
+
+    s_flush.pipe.bands = xQueueCreate(FLUSH_PIPE_DEPTH, sizeof(bsp_display_band_t));
+    s_flush.pipe.free_bufs = xQueueCreate(FLUSH_PIPE_DEPTH, sizeof(lv_color_t *));
+    s_flush.pipe.drained = xSemaphoreCreateBinary();
+    if (s_flush.pipe.bands == NULL || s_flush.pipe.free_bufs == NULL || s_flush.pipe.drained == NULL) {
+        goto err;
+    }
+    /* LVGL renders the first band into buf_act, every other buffer starts free */
+    for (size_t i = 0; i < s_flush.pipe.buf_cnt; i++) {
+        if (s_flush.pipe.bufs[i] != draw_buf->buf_act) {
+            xQueueSend(s_flush.pipe.free_bufs, &s_flush.pipe.bufs[i], 0);
+        }
+    }
+    s_flush.pipe.frame_start = true;
+    atomic_init(&s_flush.pipe.queued, 0);
+    s_flush.pipe.head = 0;
+    s_flush.pipe.tail = 0;
+    s_flush.pipe.on_bus = 0;
+
+    if (xTaskCreate(bsp_display_flush_task, "lcd_flush", FLUSH_TASK_STACK, NULL,
+                    CONFIG_BSP_DISPLAY_FLUSH_TASK_PRIORITY, &s_flush.pipe.task) != pdPASS) {
+        goto err;
+    }
+    s_flush.stats.band_buffers = s_flush.pipe.buf_cnt;
+    ESP_LOGI(TAG, "Flush pipeline with %u band buffers of %u B", (unsigned)s_flush.pipe.buf_cnt, (unsigned)buf_bytes);
+    return ESP_OK;
+
+err:
+    ESP_LOGE(TAG, "Not enough memory for the flush pipeline");
+    if (s_flush.pipe.bands) {
+        vQueueDelete(s_flush.pipe.bands);
+        s_flush.pipe.bands = NULL;
+    }
+    if (s_flush.pipe.free_bufs) {
+        vQueueDelete(s_flush.pipe.free_bufs);
+        s_flush.pipe.free_bufs = NULL;
+    }
+    if (s_flush.pipe.drained) {
+        vSemaphoreDelete(s_flush.pipe.drained);
+        s_flush.pipe.drained = NULL;
+    }
+    for (size_t i = 2; i < s_flush.pipe.buf_cnt; i++) {
+        heap_caps_free(s_flush.pipe.bufs[i]);
+    }
+    s_flush.pipe.buf_cnt = 0;
+    return ESP_ERR_NO_MEM;
+}
+#endif // CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+
+static void bsp_display_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+#if CONFIG_BSP_DISPLAY_TIMING
+    bsp_display_timing_flush_begin();
+    const uint64_t pixel_bytes = s_flush.stats.pixel_bytes;
+#endif
+#if CONFIG_BSP_DISPLAY_LATENCY
+    bsp_display_latency_flush(lv_disp_flush_is_last(drv));
+#endif
+    if (lv_disp_flush_is_last(drv)) {
+        s_flush.stats.frames++;
+    }
+#if CONFIG_BSP_DISPLAY_LVGL_DIRECT_MODE
+    bsp_display_flush_direct(drv, color_map);
+#else
+#if CONFIG_BSP_DISPLAY_LVGL_FULL_REFRESH
+    bsp_display_wait_te();
+#endif
+    bsp_display_count(lv_area_get_width(area), lv_area_get_height(area));
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+    if (s_flush.pipe.task) {
+        bsp_display_flush_pipelined(drv, area, color_map);
+    } else
+#endif
+    {
+        atomic_store(&s_flush.trans_pending, bsp_display_chunk_count(lv_area_get_width(area), lv_area_get_height(area)));
+        bsp_display_trans_done(bsp_display_draw(area->x1, area->y1, area->x2 + 1, area->y2 + 1, color_map));
+    }
+#endif
+#if CONFIG_BSP_DISPLAY_TIMING
+    bsp_display_timing_flush_end(s_flush.stats.pixel_bytes - pixel_bytes);
+#endif
+}
+
+esp_err_t bsp_display_flush_init(lv_disp_t *disp, esp_lcd_panel_io_handle_t io, esp_lcd_panel_handle_t panel,
+                                 size_t max_transfer_bytes)
+{
+    assert(disp && io && panel);
+    s_flush.disp = disp;
+    s_flush.io = io;
+    s_flush.panel = panel;
+    s_flush.max_transfer_bytes = max_transfer_bytes;
+    atomic_init(&s_flush.trans_pending, 0);
+
+#if CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+    BSP_ERROR_CHECK_RETURN_ERR(bsp_display_te_init(io));
+#endif
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+    BSP_ERROR_CHECK_RETURN_ERR(bsp_display_pipe_init(disp));
+#endif
+
+    /* Replace the callback registered by esp_lvgl_port, one LVGL flush may take several transfers */
+    const esp_lcd_panel_io_callbacks_t cbs = {
+        .on_color_trans_done = bsp_display_flush_trans_done,
+    };
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_panel_io_register_event_callbacks(io, &cbs, NULL));
+
+    lvgl_port_lock(0);
+    disp->driver->flush_cb = bsp_display_flush_cb;
+#if CONFIG_BSP_DISPLAY_LVGL_FULL_REFRESH
+    disp->driver->full_refresh = 1;
+#elif CONFIG_BSP_DISPLAY_LVGL_DIRECT_MODE
+    disp->driver->direct_mode = 1;
+#endif
+#if CONFIG_BSP_DISPLAY_FLUSH_COALESCE
+    s_flush.refr_timer_cb = disp->refr_timer->timer_cb;
+    lv_timer_set_cb(disp->refr_timer, bsp_display_refr_timer_cb);
+#endif
+    lvgl_port_unlock();
+
+    return ESP_OK;
+}
+
+esp_err_t bsp_display_flush_get_stats(bsp_display_flush_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+    BSP_NULL_CHECK(s_flush.disp, ESP_ERR_INVALID_STATE);
+
+    /* Counters are updated from the LVGL task while it holds the LVGL mutex */
+    lvgl_port_lock(0);
+    *stats = s_flush.stats;
+    lvgl_port_unlock();
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+    portENTER_CRITICAL(&s_flush.pipe.lock);
+    stats->bus_starved = s_flush.pipe.bus_starved;
+    stats->bus_idle_us = s_flush.pipe.bus_idle_us;
+    portEXIT_CRITICAL(&s_flush.pipe.lock);
+#endif
+
+    return ESP_OK;
+}
+
+void bsp_display_flush_reset_stats(void)
+{
+    lvgl_port_lock(0);
+    const uint32_t band_buffers = s_flush.stats.band_buffers;
+    memset(&s_flush.stats, 0, sizeof(s_flush.stats));
+    s_flush.stats.band_buffers = band_buffers;
+    lvgl_port_unlock();
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+    portENTER_CRITICAL(&s_flush.pipe.lock);
+    s_flush.pipe.bus_starved = 0;
+    s_flush.pipe.bus_idle_us = 0;
+    portEXIT_CRITICAL(&s_flush.pipe.lock);
+#endif
+}
@@ -0,0 +1,240 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_DISPLAY_LATENCY
+#include <inttypes.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "driver/gpio.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "esp_lvgl_port.h"
+#include "bsp_display_latency.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_latency";
+
+#define LATENCY_BUCKET_US      (1000)
+#define LATENCY_BUCKETS        (250)       // The last bucket collects everything slower
+#define LATENCY_TIMEOUT_US     (1000000)   // A touch without a frame after this long is dropped
+
+typedef enum {
+    LATENCY_IDLE,
+    LATENCY_EDGE,           // INT edge seen, LVGL has not processed the press yet
+    LATENCY_INPUT,          // LVGL processed the press, waiting for the next refresh
+    LATENCY_REFRESH,        // Refresh started, waiting for its last area
+    LATENCY_LAST_FLUSH,     // Last area is being sent, waiting for the transfers
+} bsp_latency_stage_t;
+
+static struct {
+    portMUX_TYPE lock;
+    bsp_latency_stage_t stage;
+    int64_t edge_us;
+    int64_t input_us;
+    uint32_t hist[LATENCY_BUCKETS];
+    uint32_t samples;
+    uint32_t dropped;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint64_t input_sum_us;
+    void (*feedback_cb)(lv_indev_drv_t *, uint8_t);    // Feedback callback set before ours
+#if CONFIG_BSP_DISPLAY_LATENCY_LOG_PERIOD_S
+    esp_timer_handle_t log_timer;
+#endif
+} s_latency = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+    .min_us = UINT32_MAX,
+};
+
+/* Called with the lock held */
+static void bsp_display_latency_record(int64_t now)
+{
+    const uint32_t latency = now - s_latency.edge_us;
+    s_latency.hist[LV_MIN(latency / LATENCY_BUCKET_US, LATENCY_BUCKETS - 1)]++;
+    s_latency.samples++;
+    s_latency.sum_us += latency;
+    s_latency.input_sum_us += s_latency.input_us - s_latency.edge_us;
+    s_latency.min_us = LV_MIN(s_latency.min_us, latency);
+    s_latency.max_us = LV_MAX(s_latency.max_us, latency);
+}
+
+void bsp_display_latency_touch_edge(void)
+{
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL_SAFE(&s_latency.lock);
+    /* A touch LVGL never processed, or that never reached the panel, is dropped once it gets stale */
+    if (s_latency.stage != LATENCY_IDLE && now - s_latency.edge_us > LATENCY_TIMEOUT_US) {
+        s_latency.dropped++;
+        s_latency.stage = LATENCY_IDLE;
+    }
+    /* The first edge starts the measurement, the INT pulses that follow it while the finger is down are ignored */
+    if (s_latency.stage == LATENCY_IDLE) {
+        s_latency.stage = LATENCY_EDGE;
+        s_latency.edge_us = now;
+    }
+    portEXIT_CRITICAL_SAFE(&s_latency.lock);
+}
+
+static void bsp_display_latency_feedback(lv_indev_drv_t *drv, uint8_t code)
+{
+    if (code == LV_EVENT_PRESSED) {
+        const int64_t now = esp_timer_get_time();
+        portENTER_CRITICAL(&s_latency.lock);
+        if (s_latency.stage == LATENCY_EDGE) {
+            s_latency.stage = LATENCY_INPUT;
+            s_latency.input_us = now;
+        }
+        portEXIT_CRITICAL(&s_latency.lock);
+    } else if (code == LV_EVENT_RELEASED) {
+        /* INT keeps pulsing while the finger stays down, those edges belong to no press */
+        portENTER_CRITICAL(&s_latency.lock);
+        if (s_latency.stage == LATENCY_EDGE) {
+            s_latency.stage = LATENCY_IDLE;
+        }
+        portEXIT_CRITICAL(&s_latency.lock);
+    }
+
+    if (s_latency.feedback_cb) {
+        s_latency.feedback_cb(drv, code);
+    }
+}
+
+void bsp_display_latency_flush(bool last)
+{
+    portENTER_CRITICAL(&s_latency.lock);
+    /* LVGL renders the whole refresh before the first flush, so the press is in this one */
+    if (s_latency.stage == LATENCY_INPUT) {
+        s_latency.stage = LATENCY_REFRESH;
+    }
+    if (s_latency.stage == LATENCY_REFRESH && last) {
+        s_latency.stage = LATENCY_LAST_FLUSH;
+    }
+    portEXIT_CRITICAL(&s_latency.lock);
+}
+
+void bsp_display_latency_flush_done(void)
+{
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL_SAFE(&s_latency.lock);
+    if (s_latency.stage == LATENCY_LAST_FLUSH) {
+        bsp_display_latency_record(now);
+        s_latency.stage = LATENCY_IDLE;
+    }
+    portEXIT_CRITICAL_SAFE(&s_latency.lock);
+}
+
+/* Upper bound of the bucket holding the given percentile */
+static uint32_t bsp_display_latency_percentile(const uint32_t *hist, uint32_t samples, uint32_t max_us,
+        uint32_t percent)
+{
+    const uint32_t rank = (samples * percent + 99) / 100;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < LATENCY_BUCKETS - 1; i++) {
+        count += hist[i];
+        if (count >= rank) {
+            return LV_MIN((i + 1) * LATENCY_BUCKET_US, max_us);
+        }
+    }
+    return max_us;
+}
+
+esp_err_t bsp_display_latency_get_stats(bsp_display_latency_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+
+    static uint32_t hist[LATENCY_BUCKETS];
+    portENTER_CRITICAL(&s_latency.lock);
+    memcpy(hist, s_latency.hist, sizeof(hist));
+    const uint32_t samples = s_latency.samples;
+    const uint64_t sum_us = s_latency.sum_us;
+    const uint64_t input_sum_us = s_latency.input_sum_us;
+    stats->samples = samples;
+    stats->dropped = s_latency.dropped;
+    stats->min_us = samples ? s_latency.min_us : 0;
+    stats->max_us = s_latency.max_us;
+    portEXIT_CRITICAL(&s_latency.lock);
+
+    if (samples == 0) {
+        stats->avg_us = stats->input_avg_us = 0;
+        stats->p50_us = stats->p95_us = stats->p99_us = 0;
+        return ESP_OK;
+    }
+    stats->avg_us = sum_us / samples;
+    stats->input_avg_us = input_sum_us / samples;
+    stats->p50_us = bsp_display_latency_percentile(hist, samples, stats->max_us, 50);
+    stats->p95_us = bsp_display_latency_percentile(hist, samples, stats->max_us, 95);
+    stats->p99_us = bsp_display_latency_percentile(hist, samples, stats->max_us, 99);
+    return ESP_OK;
+}
+
+void bsp_display_latency_reset(void)
+{
+    portENTER_CRITICAL(&s_latency.lock);
+    memset(s_latency.hist, 0, sizeof(s_latency.hist));
+    s_latency.samples = 0;
+    s_latency.dropped = 0;
+    s_latency.min_us = UINT32_MAX;
+    s_latency.max_us = 0;
+    s_latency.sum_us = 0;
+    s_latency.input_sum_us = 0;
+    portEXIT_CRITICAL(&s_latency.lock);
+}
+
+#if CONFIG_BSP_DISPLAY_LATENCY_LOG_PERIOD_S
+static void bsp_display_latency_log(void *arg)
+{
+    bsp_display_latency_stats_t stats;
+    bsp_display_latency_get_stats(&stats);
+    if (stats.samples == 0) {
+        return;
+    }
+    ESP_LOGI(TAG, "Touch-to-photon [us]: p50 %" PRIu32 ", p95 %" PRIu32 ", p99 %" PRIu32 ", min %" PRIu32
+             ", max %" PRIu32 ", input %" PRIu32 " avg (%" PRIu32 " touches, %" PRIu32 " dropped)",
+             stats.p50_us, stats.p95_us, stats.p99_us, stats.min_us, stats.max_us, stats.input_avg_us,
+             stats.samples, stats.dropped);
+}
+#endif
+
+#if !CONFIG_BSP_TOUCH_IRQ
+static void bsp_display_latency_gpio_isr(void *arg)
+{
+    bsp_display_latency_touch_edge();
+}
+#endif
+
+esp_err_t bsp_display_latency_init(lv_indev_t *indev)
+{
+    BSP_NULL_CHECK(indev, ESP_ERR_INVALID_ARG);
+
+#if !CONFIG_BSP_TOUCH_IRQ
+    /* The touch is polled by LVGL, watch the INT line on our own */
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_ERR_INVALID_STATE) {
+        BSP_ERROR_CHECK_RETURN_ERR(ret);
+    }
+    BSP_ERROR_CHECK_RETURN_ERR(gpio_set_intr_type(BSP_LCD_TP_INT, GPIO_INTR_NEGEDGE));
+    BSP_ERROR_CHECK_RETURN_ERR(gpio_isr_handler_add(BSP_LCD_TP_INT, bsp_display_latency_gpio_isr, NULL));
+#endif
+
+#if CONFIG_BSP_DISPLAY_LATENCY_LOG_PERIOD_S
+    const esp_timer_create_args_t timer_args = {
+        .callback = bsp_display_latency_log,
+        .name = "latency_log",
+    };
+    BSP_ERROR_CHECK_RETURN_ERR(esp_timer_create(&timer_args, &s_latency.log_timer));
+    BSP_ERROR_CHECK_RETURN_ERR(esp_timer_start_periodic(s_latency.log_timer,
+                               CONFIG_BSP_DISPLAY_LATENCY_LOG_PERIOD_S * 1000000ULL));
+#endif
+
+    lvgl_port_lock(0);
+    s_latency.feedback_cb = indev->driver->feedback_cb;
+    indev->driver->feedback_cb = bsp_display_latency_feedback;
+    lvgl_port_unlock();
+
+    ESP_LOGI(TAG, "Touch-to-photon latency measurement started");
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_DISPLAY_LATENCY
@@ -0,0 +1,135 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_DISPLAY_SPLASH
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_display_splash.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_splash";
+
+/* Bands are filled while the previous one is on the bus */
+#define SPLASH_BAND_LINES       (16)
+#define SPLASH_BANDS            (2)
+
+/* Sequential reader of the run-length encoded image */
+typedef struct {
+    const uint16_t *rle;
+    const uint16_t *end;
+    uint16_t run;
+    uint16_t color;
+} bsp_splash_reader_t;
+
+static const bsp_display_splash_t *s_splash;
+
+void bsp_display_set_splash(const bsp_display_splash_t *splash)
+{
+    s_splash = splash;
+}
+
+static uint16_t bsp_splash_color(uint32_t rgb888)
+{
+    const uint16_t rgb565 = ((rgb888 >> 8) & 0xF800) | ((rgb888 >> 5) & 0x07E0) | ((rgb888 >> 3) & 0x001F);
+    /* Most significant byte goes first on the 8-bit bus */
+    return (rgb565 >> 8) | (rgb565 << 8);
+}
+
+static void bsp_splash_read(bsp_splash_reader_t *reader, uint16_t *dst, uint16_t width)
+{
+    for (uint16_t x = 0; x < width; x++) {
+        while (reader->run == 0 && reader->rle + 1 < reader->end) {
+            reader->run = reader->rle[0];
+            reader->color = reader->rle[1];
+            reader->rle += 2;
+        }
+        if (reader->run == 0) {
+            return;     // Truncated image, the rest stays background
+        }
+        dst[x] = reader->color;
+        reader->run--;
+    }
+}
+
+static bool bsp_splash_trans_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR((SemaphoreHandle_t)user_ctx, &need_yield);
+    return need_yield == pdTRUE;
+}
+
+esp_err_t bsp_display_splash_show(esp_lcd_panel_io_handle_t io, esp_lcd_panel_handle_t panel)
+{
+    const bsp_display_splash_t bg_only = {
+        .bg_color = bsp_splash_color(CONFIG_BSP_DISPLAY_SPLASH_COLOR),
+    };
+    const bsp_display_splash_t *splash = s_splash ? s_splash : &bg_only;
+    uint16_t width = splash->width;
+    uint16_t height = splash->height;
+    if (width > BSP_LCD_H_RES || height > BSP_LCD_V_RES || (width && splash->rle == NULL)) {
+        ESP_LOGW(TAG, "Splash image %ux%u does not fit the screen, showing the background only", width, height);
+        width = 0;
+        height = 0;
+    }
+    const int x0 = (BSP_LCD_H_RES - width) / 2;
+    const int y0 = (BSP_LCD_V_RES - height) / 2;
+    bsp_splash_reader_t reader = {
+        .rle = splash->rle,
+        .end = splash->rle + splash->rle_words,
+    };
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    uint16_t *bands[SPLASH_BANDS] = { NULL };
+    SemaphoreHandle_t free_bands = xSemaphoreCreateCounting(SPLASH_BANDS, SPLASH_BANDS);
+    BSP_NULL_CHECK(free_bands, ESP_ERR_NO_MEM);
+    for (int i = 0; i < SPLASH_BANDS; i++) {
+        bands[i] = heap_caps_malloc(BSP_LCD_H_RES * SPLASH_BAND_LINES * sizeof(uint16_t), MALLOC_CAP_DMA);
+        BSP_NULL_CHECK_GOTO(bands[i], err);
+    }
+    const esp_lcd_panel_io_callbacks_t cbs = {
+        .on_color_trans_done = bsp_splash_trans_done,
+    };
+    ret = esp_lcd_panel_io_register_event_callbacks(io, &cbs, free_bands);
+    if (ret != ESP_OK) {
+        goto err;
+    }
+
+    for (int y = 0, n = 0; y < BSP_LCD_V_RES; y += SPLASH_BAND_LINES, n++) {
+        const int lines = LV_MIN(SPLASH_BAND_LINES, BSP_LCD_V_RES - y);
+        uint16_t *band = bands[n % SPLASH_BANDS];
+        xSemaphoreTake(free_bands, portMAX_DELAY);
+        for (int row = 0; row < lines; row++) {
+            uint16_t *line = band + row * BSP_LCD_H_RES;
+            for (int x = 0; x < BSP_LCD_H_RES; x++) {
+                line[x] = splash->bg_color;
+            }
+            if (y + row >= y0 && y + row < y0 + height) {
+                bsp_splash_read(&reader, line + x0, width);
+            }
+        }
+        ret = esp_lcd_panel_draw_bitmap(panel, 0, y, BSP_LCD_H_RES, y + lines, band);
+        if (ret != ESP_OK) {
+            xSemaphoreGive(free_bands);
+            break;
+        }
+    }
+
+    /* All bands must be on the panel before the buffers are freed */
+    for (int i = 0; i < SPLASH_BANDS; i++) {
+        xSemaphoreTake(free_bands, portMAX_DELAY);
+    }
+    const esp_lcd_panel_io_callbacks_t no_cbs = { 0 };
+    esp_lcd_panel_io_register_event_callbacks(io, &no_cbs, NULL);
+
+err:
+    for (int i = 0; i < SPLASH_BANDS; i++) {
+        heap_caps_free(bands[i]);
+    }
+    vSemaphoreDelete(free_bands);
+    return ret;
+}
+#endif // CONFIG_BSP_DISPLAY_SPLASH
@@ -0,0 +1,312 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_DISPLAY_TIMING
+#include <inttypes.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "esp_lvgl_port.h"
+#include "bsp_display_timing.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_timing";
+
+/* Four buckets per power of two, values below 4 have their own bucket. Error is below 25 % */
+#define HIST_SUB_BITS           (2)
+#define HIST_SUB                (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS            ((32 - HIST_SUB_BITS + 1) * HIST_SUB)
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t buckets[HIST_BUCKETS];
+} bsp_timing_hist_t;
+
+typedef enum {
+    HIST_RENDER,
+    HIST_FLUSH_SUBMIT,
+    HIST_FLUSH_DONE,
+    HIST_DMA_WAIT,
+    HIST_BUS_BYTES,
+    HIST_LOCK_WAIT,
+    HIST_LOCK_HOLD,
+    HIST_PERIOD,
+    HIST_JITTER,
+    HIST_MAX,
+} bsp_timing_hist_id_t;
+
+static struct {
+    portMUX_TYPE lock;
+    bsp_timing_hist_t hist[HIST_MAX];
+    uint32_t frames;
+    lv_timer_cb_t refr_timer_cb;    // Refresh timer callback set before ours
+    void (*wait_cb)(lv_disp_drv_t *);
+    /* Current refresh, only touched by the LVGL task */
+    int64_t frame_start_us;
+    int64_t last_frame_us;      // Start of the previous refresh if it rendered, otherwise 0
+    uint32_t frame_flushes;
+    uint32_t frame_bytes;
+    int64_t frame_submit_us;
+    int64_t frame_wait_us;
+    int64_t wait_start_us;      // First wait_cb call of the current wait, 0 when not waiting
+    int64_t wait_last_us;       // Last wait_cb call of the current wait
+    /* Current flush, the end is seen from ISR */
+    int64_t flush_start_us;
+    /* Display lock, only touched by its holder */
+    uint32_t lock_depth;
+    int64_t lock_start_us;
+#if CONFIG_BSP_DISPLAY_TIMING_LOG_PERIOD_S
+    esp_timer_handle_t log_timer;
+#endif
+} s_timing = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static uint32_t bsp_timing_bucket(uint32_t value)
+{
+    if (value < HIST_SUB) {
+        return value;
+    }
+    const uint32_t msb = 31 - __builtin_clz(value);
+    const uint32_t sub = (value >> (msb - HIST_SUB_BITS)) & (HIST_SUB - 1);
+    return (msb - HIST_SUB_BITS + 1) * HIST_SUB + sub;
+}
+
+/* Largest value that falls into the bucket */
+static uint32_t bsp_timing_bucket_max(uint32_t bucket)
+{
+    if (bucket < HIST_SUB) {
+        return bucket;
+    }
+    const uint32_t shift = bucket / HIST_SUB - 1;
+    const uint64_t lower = (uint64_t)(HIST_SUB + bucket % HIST_SUB) << shift;
+    return LV_MIN(lower + (1ULL << shift) - 1, UINT32_MAX);
+}
+
+static void bsp_timing_record(bsp_timing_hist_id_t id, int64_t value)
+{
+    const uint32_t v = value < 0 ? 0 : LV_MIN(value, UINT32_MAX);
+    portENTER_CRITICAL_SAFE(&s_timing.lock);
+    bsp_timing_hist_t *hist = &s_timing.hist[id];
+    if (hist->count == 0 || v < hist->min) {
+        hist->min = v;
+    }
+    hist->max = LV_MAX(hist->max, v);
+    hist->count++;
+    hist->sum += v;
+    hist->buckets[bsp_timing_bucket(v)]++;
+    portEXIT_CRITICAL_SAFE(&s_timing.lock);
+}
+
+/*
+ * Percentiles are taken in one walk over the buckets with the lock held, which costs about as much as copying the
+ * histogram out and needs no scratch copy, so the stats can be read from any task without the LVGL lock.
+ */
+static void bsp_timing_summary(bsp_timing_hist_id_t id, bsp_display_timing_hist_t *out)
+{
+    uint32_t *const pct[] = { &out->p50, &out->p95, &out->p99 };
+    static const uint32_t percent[] = { 50, 95, 99 };
+    const uint32_t n = sizeof(percent) / sizeof(percent[0]);
+
+    memset(out, 0, sizeof(*out));
+    portENTER_CRITICAL(&s_timing.lock);
+    const bsp_timing_hist_t *hist = &s_timing.hist[id];
+    if (hist->count > 0) {
+        uint32_t p = 0;
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < HIST_BUCKETS && p < n; i++) {
+            count += hist->buckets[i];
+            while (p < n && count >= ((uint64_t)hist->count * percent[p] + 99) / 100) {
+                *pct[p++] = LV_MIN(bsp_timing_bucket_max(i), hist->max);
+            }
+        }
+        for (; p < n; p++) {
+            *pct[p] = hist->max;
+        }
+        out->count = hist->count;
+        out->min = hist->min;
+        out->avg = hist->sum / hist->count;
+        out->max = hist->max;
+    }
+    portEXIT_CRITICAL(&s_timing.lock);
+}
+
+/* LVGL spins in wait_cb while a flush is in progress, the last call marks the end of the wait */
+static void bsp_timing_wait_close(void)
+{
+    if (s_timing.wait_start_us) {
+        s_timing.frame_wait_us += s_timing.wait_last_us - s_timing.wait_start_us;
+        s_timing.wait_start_us = 0;
+    }
+}
+
+static void bsp_timing_wait_cb(lv_disp_drv_t *drv)
+{
+    const int64_t now = esp_timer_get_time();
+    if (s_timing.wait_start_us == 0) {
+        s_timing.wait_start_us = now;
+    }
+    s_timing.wait_last_us = now;
+
+    if (s_timing.wait_cb) {
+        s_timing.wait_cb(drv);
+    }
+}
+
+void bsp_display_timing_flush_begin(void)
+{
+    bsp_timing_wait_close();
+    s_timing.flush_start_us = esp_timer_get_time();
+}
+
+void bsp_display_timing_flush_end(uint32_t bytes)
+{
+    const int64_t submit = esp_timer_get_time() - s_timing.flush_start_us;
+    bsp_timing_record(HIST_FLUSH_SUBMIT, submit);
+    s_timing.frame_submit_us += submit;
+    s_timing.frame_bytes += bytes;
+    s_timing.frame_flushes++;
+}
+
+void bsp_display_timing_flush_done(void)
+{
+    bsp_timing_record(HIST_FLUSH_DONE, esp_timer_get_time() - s_timing.flush_start_us);
+}
+
+void bsp_display_timing_locked(int64_t start_us)
+{
+    const int64_t now = esp_timer_get_time();
+    /* The lock is recursive, only the outermost lock and unlock count */
+    if (s_timing.lock_depth++ == 0) {
+        bsp_timing_record(HIST_LOCK_WAIT, now - start_us);
+        s_timing.lock_start_us = now;
+    }
+}
+
+void bsp_display_timing_unlock(void)
+{
+    if (s_timing.lock_depth > 0 && --s_timing.lock_depth == 0) {
+        bsp_timing_record(HIST_LOCK_HOLD, esp_timer_get_time() - s_timing.lock_start_us);
+    }
+}
+
+static void bsp_timing_refr_timer_cb(lv_timer_t *timer)
+{
+    s_timing.frame_start_us = esp_timer_get_time();
+    s_timing.frame_flushes = 0;
+    s_timing.frame_bytes = 0;
+    s_timing.frame_submit_us = 0;
+    s_timing.frame_wait_us = 0;
+    s_timing.wait_start_us = 0;
+
+    s_timing.refr_timer_cb(timer);
+
+    const int64_t end = esp_timer_get_time();
+    bsp_timing_wait_close();
+    if (s_timing.frame_flushes == 0) {
+        /* Nothing was invalidated, the next frame has no period */
+        s_timing.last_frame_us = 0;
+        return;
+    }
+
+    bsp_timing_record(HIST_RENDER, end - s_timing.frame_start_us - s_timing.frame_submit_us - s_timing.frame_wait_us);
+    bsp_timing_record(HIST_DMA_WAIT, s_timing.frame_wait_us);
+    bsp_timing_record(HIST_BUS_BYTES, s_timing.frame_bytes);
+    if (s_timing.last_frame_us) {
+        const int64_t period = s_timing.frame_start_us - s_timing.last_frame_us;
+        const int64_t jitter = period - (int64_t)timer->period * 1000;
+        bsp_timing_record(HIST_PERIOD, period);
+        bsp_timing_record(HIST_JITTER, jitter < 0 ? -jitter : jitter);
+    }
+    s_timing.last_frame_us = s_timing.frame_start_us;
+
+    portENTER_CRITICAL(&s_timing.lock);
+    s_timing.frames++;
+    portEXIT_CRITICAL(&s_timing.lock);
+}
+
+esp_err_t bsp_display_timing_get_stats(bsp_display_timing_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+
+    portENTER_CRITICAL(&s_timing.lock);
+    stats->frames = s_timing.frames;
+    portEXIT_CRITICAL(&s_timing.lock);
+    bsp_timing_summary(HIST_RENDER, &stats->render_us);
+    bsp_timing_summary(HIST_FLUSH_SUBMIT, &stats->flush_submit_us);
+    bsp_timing_summary(HIST_FLUSH_DONE, &stats->flush_done_us);
+    bsp_timing_summary(HIST_DMA_WAIT, &stats->dma_wait_us);
+    bsp_timing_summary(HIST_BUS_BYTES, &stats->bus_bytes);
+    bsp_timing_summary(HIST_LOCK_WAIT, &stats->lock_wait_us);
+    bsp_timing_summary(HIST_LOCK_HOLD, &stats->lock_hold_us);
+    bsp_timing_summary(HIST_PERIOD, &stats->period_us);
+    bsp_timing_summary(HIST_JITTER, &stats->jitter_us);
+    return ESP_OK;
+}
+
+void bsp_display_timing_reset(void)
+{
+    portENTER_CRITICAL(&s_timing.lock);
+    memset(s_timing.hist, 0, sizeof(s_timing.hist));
+    s_timing.frames = 0;
+    portEXIT_CRITICAL(&s_timing.lock);
+}
+
+#if CONFIG_BSP_DISPLAY_TIMING_LOG_PERIOD_S
+static void bsp_timing_log_hist(const char *name, const bsp_display_timing_hist_t *hist)
+{
+    ESP_LOGI(TAG, "%-16s: p50 %8" PRIu32 ", p95 %8" PRIu32 ", p99 %8" PRIu32 ", max %8" PRIu32 " (%" PRIu32 ")",
+             name, hist->p50, hist->p95, hist->p99, hist->max, hist->count);
+}
+
+static void bsp_timing_log(void *arg)
+{
+    static bsp_display_timing_stats_t stats;
+    bsp_display_timing_get_stats(&stats);
+    if (stats.frames == 0) {
+        return;
+    }
+    ESP_LOGI(TAG, "%" PRIu32 " frames", stats.frames);
+    bsp_timing_log_hist("render [us]", &stats.render_us);
+    bsp_timing_log_hist("flush submit [us]", &stats.flush_submit_us);
+    bsp_timing_log_hist("flush done [us]", &stats.flush_done_us);
+    bsp_timing_log_hist("DMA wait [us]", &stats.dma_wait_us);
+    bsp_timing_log_hist("bus [bytes]", &stats.bus_bytes);
+    bsp_timing_log_hist("lock wait [us]", &stats.lock_wait_us);
+    bsp_timing_log_hist("lock hold [us]", &stats.lock_hold_us);
+    bsp_timing_log_hist("period [us]", &stats.period_us);
+    bsp_timing_log_hist("jitter [us]", &stats.jitter_us);
+}
+#endif
+
+esp_err_t bsp_display_timing_init(lv_disp_t *disp)
+{
+    BSP_NULL_CHECK(disp, ESP_ERR_INVALID_ARG);
+
+#if CONFIG_BSP_DISPLAY_TIMING_LOG_PERIOD_S
+    const esp_timer_create_args_t timer_args = {
+        .callback = bsp_timing_log,
+        .name = "timing_log",
+    };
+    BSP_ERROR_CHECK_RETURN_ERR(esp_timer_create(&timer_args, &s_timing.log_timer));
+    BSP_ERROR_CHECK_RETURN_ERR(esp_timer_start_periodic(s_timing.log_timer,
+                               CONFIG_BSP_DISPLAY_TIMING_LOG_PERIOD_S * 1000000ULL));
+#endif
+
+    lvgl_port_lock(0);
+    s_timing.refr_timer_cb = disp->refr_timer->timer_cb;
+    lv_timer_set_cb(disp->refr_timer, bsp_timing_refr_timer_cb);
+    s_timing.wait_cb = disp->driver->wait_cb;
+    disp->driver->wait_cb = bsp_timing_wait_cb;
+    lvgl_port_unlock();
+
+    ESP_LOGI(TAG, "Frame timing started");
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_DISPLAY_TIMING
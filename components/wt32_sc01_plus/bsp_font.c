@@ -0,0 +1,905 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_FONT
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_font";
+
+#define FONT_CACHE_BYTES        (CONFIG_BSP_FONT_CACHE_KB * 1024)
+#define FONT_CACHE_BUCKET_BITS  (8)
+#define FONT_CACHE_BUCKETS      (1 << FONT_CACHE_BUCKET_BITS)
+#define FONT_FILE_BUFFER        (512)       // stdio buffer of a font file, glyph reads are small and scattered
+#define FONT_GLYPH_HEADER_MAX   (8)         // Bytes of the bit fields at the start of a glyph record
+#define FONT_BOX_MAX            (UINT8_MAX) // lv_font_glyph_dsc_t box_w and box_h
+#define FONT_PRELOAD_BYTES      (CONFIG_BSP_FONT_PRELOAD_KB * 1024)
+
+#if CONFIG_SPIRAM
+#define FONT_CAPS               (MALLOC_CAP_SPIRAM)
+#else
+#define FONT_CAPS               (MALLOC_CAP_DEFAULT)
+#endif
+
+/* Binary format written by lv_font_conv, see lv_font_loader.c. Little endian, like the target */
+typedef struct __attribute__((packed)) {
+    uint32_t length;                    // Section size, this label included
+    char tag[4];
+} font_label_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t version;
+    uint16_t tables_count;
+    uint16_t font_size;
+    uint16_t ascent;
+    int16_t descent;
+    uint16_t typo_ascent;
+    int16_t typo_descent;
+    uint16_t typo_line_gap;
+    int16_t min_y;
+    int16_t max_y;
+    uint16_t default_advance_width;
+    uint16_t kerning_scale;
+    uint8_t index_to_loc_format;        // loca offsets: 0 uint16_t, 1 uint32_t
+    uint8_t glyph_id_format;
+    uint8_t advance_width_format;       // 0 whole pixels, 1 in 1/16 px
+    uint8_t bits_per_pixel;
+    uint8_t xy_bits;
+    uint8_t wh_bits;
+    uint8_t advance_width_bits;         // 0 when every glyph has default_advance_width
+    uint8_t compression_id;             // LV_FONT_FMT_TXT_x
+    uint8_t subpixels_mode;
+    uint8_t padding;
+    int16_t underline_position;
+    uint16_t underline_thickness;
+} font_head_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t data_offset;               // From the start of the cmap section
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t data_entries_count;
+    uint8_t format_type;                // LV_FONT_FMT_TXT_CMAP_x
+    uint8_t padding;
+} font_cmap_entry_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t list_length;
+    uint8_t type;                       // LV_FONT_FMT_TXT_CMAP_x
+    const uint16_t *unicode_list;       // Sparse maps: code points relative to range_start, ascending
+    const void *glyph_id_ofs;           // FORMAT0_FULL: uint8_t per code point, SPARSE_FULL: uint16_t per list item
+} font_cmap_t;
+
+typedef struct {
+    uint32_t offset;                    // Raw bitmap in the font, it starts shift bits into this byte
+    uint32_t size;                      // Raw bitmap bytes, 0 for glyphs without pixels
+    uint32_t adv_w;                     // In 1/16 px
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+} font_glyph_t;
+
+typedef struct {
+    lv_font_t font;                     // Handed to LVGL, font.dsc points back to this struct
+    FILE *file;                         // Font read from a file system, NULL for an asset or a preloaded file
+    const uint8_t *data;                // Asset in the mapped partition or the preloaded file, NULL for a file
+    uint8_t *preload;                   // Copy of a file that fit into CONFIG_BSP_FONT_PRELOAD_KB
+    uint32_t size;
+    uint8_t bpp;
+    uint8_t compression;                // LV_FONT_FMT_TXT_x
+    uint8_t shift;                      // Bits of the glyph record in the first byte of every bitmap
+    uint16_t cmap_count;
+    font_cmap_t *cmaps;                 // One allocation with the lists behind the maps
+    uint32_t glyph_count;
+    font_glyph_t *glyphs;
+    uint8_t *raw;                       // Read buffer of the largest raw bitmap, files only
+} bsp_font_t;
+
+/* Decoded bitmap of one glyph */
+typedef struct font_entry {
+    struct font_entry *hash_next;
+    struct font_entry *newer;           // Towards s_font.newest
+    struct font_entry *older;
+    const bsp_font_t *font;
+    uint32_t gid;
+    uint32_t size;                      // Cache bytes of the entry, this header included
+    uint8_t bitmap[];
+} font_entry_t;
+
+/* Decoder state of a compressed bitmap, see lv_font_fmt_txt.c */
+typedef struct {
+    const uint8_t *in;
+    uint32_t size;
+    uint32_t pos;                       // Read position in bits
+    uint8_t bpp;
+    uint8_t prev;                       // Last value read
+    uint8_t count;
+    bool started;                       // The first value never starts a repeat
+    enum { RLE_SINGLE, RLE_REPEAT, RLE_COUNTER } state;
+} font_rle_t;
+
+/* The cache is only used by the LVGL task, under the display lock */
+static struct {
+    font_entry_t *buckets[FONT_CACHE_BUCKETS];
+    font_entry_t *newest;
+    font_entry_t *oldest;
+    uint8_t line[FONT_BOX_MAX];         // Previous line of a prefiltered compressed bitmap
+    portMUX_TYPE lock;                  // Protects the stats
+    bsp_font_stats_t stats;
+} s_font = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+/*******************************************************************************
+* Glyph lookup
+*******************************************************************************/
+
+static int bsp_font_cmp_u16(const void *a, const void *b)
+{
+    return (int) * (const uint16_t *)a - (int) * (const uint16_t *)b;
+}
+
+/* Glyph ID of a letter, 0 when the font does not have it */
+static uint32_t bsp_font_glyph_id(const bsp_font_t *font, uint32_t letter)
+{
+    if (letter == '\0') {
+        return 0;
+    }
+    for (uint16_t i = 0; i < font->cmap_count; i++) {
+        const font_cmap_t *cmap = &font->cmaps[i];
+        const uint32_t rcp = letter - cmap->range_start;    // Wraps around below the range
+        if (rcp >= cmap->range_length) {
+            continue;
+        }
+
+        uint32_t gid = 0;
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            gid = cmap->glyph_id_start + rcp;
+        } else if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            gid = cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs)[rcp];
+        } else {
+            const uint16_t key = rcp;
+            const uint16_t *item = bsearch(&key, cmap->unicode_list, cmap->list_length, sizeof(uint16_t),
+                                           bsp_font_cmp_u16);
+            if (item) {
+                const uint32_t index = item - cmap->unicode_list;
+                gid = cmap->glyph_id_start + (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY ? index :
+                                              ((const uint16_t *)cmap->glyph_id_ofs)[index]);
+            }
+        }
+        /* The first map covering the letter decides, like in LVGL */
+        return gid < font->glyph_count ? gid : 0;
+    }
+    return 0;
+}
+
+static bool bsp_font_get_glyph_dsc(const lv_font_t *lv_font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                                   uint32_t letter_next)
+{
+    LV_UNUSED(letter_next);
+    const bsp_font_t *font = lv_font->dsc;
+    const bool is_tab = (letter == '\t');
+    const uint32_t gid = bsp_font_glyph_id(font, is_tab ? ' ' : letter);
+    if (gid == 0) {
+        return false;
+    }
+
+    /* A tab is two spaces wide */
+    const font_glyph_t *glyph = &font->glyphs[gid];
+    const uint32_t adv_w = is_tab ? glyph->adv_w * 2 : glyph->adv_w;
+    dsc_out->adv_w = (adv_w + (1 << 3)) >> 4;
+    dsc_out->box_w = glyph->box_w;
+    dsc_out->box_h = glyph->box_h;
+    dsc_out->ofs_x = glyph->ofs_x;
+    dsc_out->ofs_y = glyph->ofs_y;
+    dsc_out->bpp = font->bpp;
+    dsc_out->is_placeholder = false;
+    return true;
+}
+
+/*******************************************************************************
+* Bitmaps
+*******************************************************************************/
+
+/* len <= 8 bits at bit pos, MSB first. Bits past the end read as 0 */
+static inline uint8_t bsp_font_bits(const uint8_t *in, uint32_t size, uint32_t pos, uint8_t len)
+{
+    const uint32_t byte = pos >> 3;
+    const uint32_t hi = byte < size ? in[byte] : 0;
+    const uint32_t lo = byte + 1 < size ? in[byte + 1] : 0;
+    return (((hi << 8) | lo) >> (16 - (pos & 7) - len)) & ((1 << len) - 1);
+}
+
+static uint8_t bsp_font_rle_read(font_rle_t *rle, uint8_t len)
+{
+    const uint8_t value = bsp_font_bits(rle->in, rle->size, rle->pos, len);
+    rle->pos += len;
+    return value;
+}
+
+/* Next pixel: single values, repeats of the last one counted in 1 bits, long repeats with a 6 bit counter */
+static uint8_t bsp_font_rle_next(font_rle_t *rle)
+{
+    switch (rle->state) {
+    case RLE_SINGLE: {
+        const uint8_t value = bsp_font_rle_read(rle, rle->bpp);
+        if (rle->started && value == rle->prev) {
+            rle->count = 0;
+            rle->state = RLE_REPEAT;
+        }
+        rle->prev = value;
+        rle->started = true;
+        return value;
+    }
+    case RLE_REPEAT:
+        rle->count++;
+        if (bsp_font_rle_read(rle, 1) == 1) {
+            if (rle->count == 11) {
+                rle->count = bsp_font_rle_read(rle, 6);
+                if (rle->count != 0) {
+                    rle->state = RLE_COUNTER;
+                } else {
+                    rle->prev = bsp_font_rle_read(rle, rle->bpp);
+                    rle->state = RLE_SINGLE;
+                }
+            }
+            return rle->prev;
+        }
+        rle->prev = bsp_font_rle_read(rle, rle->bpp);
+        rle->state = RLE_SINGLE;
+        return rle->prev;
+    case RLE_COUNTER:
+        if (--rle->count == 0) {
+            rle->prev = bsp_font_rle_read(rle, rle->bpp);
+            rle->state = RLE_SINGLE;
+        }
+        return rle->prev;
+    }
+    return 0;
+}
+
+/* Decoded bitmap bytes of a glyph */
+static uint32_t bsp_font_bitmap_size(const bsp_font_t *font, const font_glyph_t *glyph)
+{
+    if (font->compression == LV_FONT_FMT_TXT_PLAIN) {
+        return glyph->size;
+    }
+    return (glyph->box_w * glyph->box_h * font->bpp + 7) / 8;
+}
+
+/* Decode the raw bitmap of a glyph, starting font->shift bits into raw, into out */
+static void bsp_font_decode(const bsp_font_t *font, const font_glyph_t *glyph, const uint8_t *raw, uint8_t *out)
+{
+    const uint8_t shift = font->shift;
+    if (font->compression == LV_FONT_FMT_TXT_PLAIN) {
+        if (shift == 0) {
+            memcpy(out, raw, glyph->size);
+        } else {
+            for (uint32_t i = 0; i < glyph->size; i++) {
+                out[i] = bsp_font_bits(raw, glyph->size, i * 8 + shift, 8);
+            }
+        }
+        return;
+    }
+
+    /* Lines are XORed with the previous one before compression, unless without prefilter */
+    const bool prefilter = (font->compression == LV_FONT_FMT_TXT_COMPRESSED);
+    font_rle_t rle = {
+        .in = raw,
+        .size = glyph->size,
+        .pos = shift,
+        .bpp = font->bpp,
+        .state = RLE_SINGLE,
+    };
+    memset(s_font.line, 0, glyph->box_w);
+    memset(out, 0, bsp_font_bitmap_size(font, glyph));
+    uint32_t wr = 0;
+    for (uint32_t y = 0; y < glyph->box_h; y++) {
+        for (uint32_t x = 0; x < glyph->box_w; x++) {
+            const uint8_t value = bsp_font_rle_next(&rle);
+            s_font.line[x] = prefilter ? s_font.line[x] ^ value : value;
+            out[wr >> 3] |= s_font.line[x] << (8 - (wr & 7) - font->bpp);
+            wr += font->bpp;
+        }
+    }
+}
+
+/*******************************************************************************
+* Glyph cache
+*******************************************************************************/
+
+static inline font_entry_t **bsp_font_bucket(const bsp_font_t *font, uint32_t gid)
+{
+    const uint32_t hash = (gid ^ ((uintptr_t)font >> 4)) * 2654435761u;
+    return &s_font.buckets[hash >> (32 - FONT_CACHE_BUCKET_BITS)];
+}
+
+static void bsp_font_lru_unlink(font_entry_t *entry)
+{
+    if (entry->newer) {
+        entry->newer->older = entry->older;
+    } else {
+        s_font.newest = entry->older;
+    }
+    if (entry->older) {
+        entry->older->newer = entry->newer;
+    } else {
+        s_font.oldest = entry->newer;
+    }
+}
+
+static void bsp_font_lru_push(font_entry_t *entry)
+{
+    entry->newer = NULL;
+    entry->older = s_font.newest;
+    if (s_font.newest) {
+        s_font.newest->newer = entry;
+    } else {
+        s_font.oldest = entry;
+    }
+    s_font.newest = entry;
+}
+
+static font_entry_t *bsp_font_cache_find(const bsp_font_t *font, uint32_t gid)
+{
+    for (font_entry_t *entry = *bsp_font_bucket(font, gid); entry; entry = entry->hash_next) {
+        if (entry->font == font && entry->gid == gid) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void bsp_font_cache_insert(font_entry_t *entry)
+{
+    font_entry_t **bucket = bsp_font_bucket(entry->font, entry->gid);
+    entry->hash_next = *bucket;
+    *bucket = entry;
+    bsp_font_lru_push(entry);
+}
+
+static void bsp_font_cache_remove(font_entry_t *entry, bool evicted)
+{
+    font_entry_t **link = bsp_font_bucket(entry->font, entry->gid);
+    while (*link != entry) {
+        link = &(*link)->hash_next;
+    }
+    *link = entry->hash_next;
+    bsp_font_lru_unlink(entry);
+
+    portENTER_CRITICAL(&s_font.lock);
+    s_font.stats.glyphs--;
+    s_font.stats.cache_bytes -= entry->size;
+    s_font.stats.evictions += evicted;
+    portEXIT_CRITICAL(&s_font.lock);
+    heap_caps_free(entry);
+}
+
+/* Entry for a bitmap of bitmap_size bytes, the least recently drawn glyphs make room */
+static font_entry_t *bsp_font_cache_alloc(uint32_t bitmap_size)
+{
+    const uint32_t size = sizeof(font_entry_t) + bitmap_size;
+    if (size > FONT_CACHE_BYTES) {
+        return NULL;
+    }
+    while (s_font.stats.cache_bytes + size > FONT_CACHE_BYTES) {
+        bsp_font_cache_remove(s_font.oldest, true);
+    }
+    /* The budget may fit while the heap does not, the cache gives way to it too */
+    font_entry_t *entry = heap_caps_malloc(size, FONT_CAPS);
+    while (entry == NULL && s_font.oldest) {
+        bsp_font_cache_remove(s_font.oldest, true);
+        entry = heap_caps_malloc(size, FONT_CAPS);
+    }
+    if (entry) {
+        entry->size = size;
+    }
+    return entry;
+}
+
+/* Raw bitmap of a glyph: in place for an asset or a preloaded file, read into font->raw for a file.
+ * The read runs under the display lock and waits for any other user of the card. */
+static const uint8_t *bsp_font_raw(const bsp_font_t *font, const font_glyph_t *glyph)
+{
+    if (font->data) {
+        return font->data + glyph->offset;
+    }
+    if (fseek(font->file, glyph->offset, SEEK_SET) != 0 ||
+            fread(font->raw, 1, glyph->size, font->file) != glyph->size) {
+        return NULL;
+    }
+    return font->raw;
+}
+
+static const uint8_t *bsp_font_get_glyph_bitmap(const lv_font_t *lv_font, uint32_t letter)
+{
+    const bsp_font_t *font = lv_font->dsc;
+    const uint32_t gid = bsp_font_glyph_id(font, letter == '\t' ? ' ' : letter);
+    const font_glyph_t *glyph = &font->glyphs[gid];
+    if (gid == 0 || glyph->size == 0) {
+        return NULL;
+    }
+
+    if (font->data && font->compression == LV_FONT_FMT_TXT_PLAIN && font->shift == 0) {
+        portENTER_CRITICAL(&s_font.lock);
+        s_font.stats.direct++;
+        portEXIT_CRITICAL(&s_font.lock);
+        return font->data + glyph->offset;
+    }
+
+    /* LVGL draws the bitmap before it asks for the next one, so a later miss may evict it */
+    font_entry_t *entry = bsp_font_cache_find(font, gid);
+    if (entry) {
+        bsp_font_lru_unlink(entry);
+        bsp_font_lru_push(entry);
+        portENTER_CRITICAL(&s_font.lock);
+        s_font.stats.hits++;
+        portEXIT_CRITICAL(&s_font.lock);
+        return entry->bitmap;
+    }
+
+    const int64_t start_us = esp_timer_get_time();
+    entry = bsp_font_cache_alloc(bsp_font_bitmap_size(font, glyph));
+    const uint8_t *raw = entry ? bsp_font_raw(font, glyph) : NULL;
+    if (raw == NULL) {
+        heap_caps_free(entry);
+        portENTER_CRITICAL(&s_font.lock);
+        s_font.stats.errors++;
+        portEXIT_CRITICAL(&s_font.lock);
+        return NULL;
+    }
+    bsp_font_decode(font, glyph, raw, entry->bitmap);
+    entry->font = font;
+    entry->gid = gid;
+    bsp_font_cache_insert(entry);
+
+    const uint32_t miss_us = esp_timer_get_time() - start_us;
+    portENTER_CRITICAL(&s_font.lock);
+    s_font.stats.misses++;
+    s_font.stats.glyphs++;
+    s_font.stats.cache_bytes += entry->size;
+    s_font.stats.miss_us += miss_us;
+    s_font.stats.miss_us_max = LV_MAX(s_font.stats.miss_us_max, miss_us);
+    portEXIT_CRITICAL(&s_font.lock);
+    return entry->bitmap;
+}
+
+/*******************************************************************************
+* Loading
+*******************************************************************************/
+
+static esp_err_t bsp_font_read(const bsp_font_t *font, uint32_t offset, void *buf, uint32_t size)
+{
+    if (offset > font->size || size > font->size - offset) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (font->data) {
+        memcpy(buf, font->data + offset, size);
+        return ESP_OK;
+    }
+    if (fseek(font->file, offset, SEEK_SET) != 0 || fread(buf, 1, size, font->file) != size) {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/* Check the label of the section at offset, its length includes the label */
+static esp_err_t bsp_font_section(const bsp_font_t *font, uint32_t offset, const char *tag, uint32_t *length)
+{
+    font_label_t label;
+    esp_err_t ret = bsp_font_read(font, offset, &label, sizeof(label));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (memcmp(label.tag, tag, sizeof(label.tag)) != 0) {
+        ESP_LOGE(TAG, "No '%s' section at %" PRIu32, tag, offset);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (label.length < sizeof(label) || label.length > font->size - offset) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    *length = label.length;
+    return ESP_OK;
+}
+
+/* Bit field of a glyph record, MSB first */
+static uint32_t bsp_font_field(const uint8_t *record, uint32_t *pos, uint8_t len)
+{
+    uint32_t value = 0;
+    for (; len > 0; len--, (*pos)++) {
+        value = (value << 1) | ((record[*pos >> 3] >> (7 - (*pos & 7))) & 1);
+    }
+    return value;
+}
+
+static int32_t bsp_font_field_signed(const uint8_t *record, uint32_t *pos, uint8_t len)
+{
+    const uint32_t value = bsp_font_field(record, pos, len);
+    if (len > 0 && (value & (1u << (len - 1)))) {
+        return (int32_t)(value | (~0u << len));
+    }
+    return value;
+}
+
+static esp_err_t bsp_font_load_head(bsp_font_t *font, font_head_t *head, uint32_t *length)
+{
+    esp_err_t ret = bsp_font_section(font, 0, "head", length);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (*length < sizeof(font_label_t) + sizeof(*head)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    ret = bsp_font_read(font, sizeof(font_label_t), head, sizeof(*head));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    /* Fields must fit font_glyph_t and lv_font_glyph_dsc_t. 3 bpp would need another draw path */
+    const uint8_t bpp = head->bits_per_pixel;
+    if ((bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) ||
+            head->compression_id > LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER || head->index_to_loc_format > 1 ||
+            head->advance_width_bits > 16 || head->xy_bits > 8 || head->wh_bits > 8) {
+        ESP_LOGE(TAG, "Unsupported font: %u bpp, compression %u, fields %u/%u/%u bits", bpp, head->compression_id,
+                 head->advance_width_bits, head->xy_bits, head->wh_bits);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    font->bpp = bpp;
+    font->compression = head->compression_id;
+    return ESP_OK;
+}
+
+/* Character maps and their lists, in one allocation */
+static esp_err_t bsp_font_load_cmaps(bsp_font_t *font, uint32_t start, uint32_t *length)
+{
+    uint32_t count = 0;
+    esp_err_t ret = bsp_font_section(font, start, "cmap", length);
+    if (ret == ESP_OK) {
+        ret = bsp_font_read(font, start + sizeof(font_label_t), &count, sizeof(count));
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    const uint32_t table = sizeof(font_label_t) + sizeof(count);
+    if (count == 0 || count > UINT16_MAX || *length < table || count > (*length - table) / sizeof(font_cmap_entry_t)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    font_cmap_entry_t *entries = heap_caps_malloc(count * sizeof(font_cmap_entry_t), FONT_CAPS);
+    BSP_NULL_CHECK(entries, ESP_ERR_NO_MEM);
+    ret = bsp_font_read(font, start + table, entries, count * sizeof(font_cmap_entry_t));
+    if (ret != ESP_OK) {
+        goto out;
+    }
+
+    /* Bytes of the lists in the file, every list stays 4-byte aligned in RAM */
+    size_t lists_size = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const font_cmap_entry_t *entry = &entries[i];
+        uint32_t size;
+        switch (entry->format_type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+            size = entry->data_entries_count;
+            break;
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+            size = 2 * entry->data_entries_count * sizeof(uint16_t);
+            break;
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+            size = entry->data_entries_count * sizeof(uint16_t);
+            break;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            size = 0;
+            break;
+        default:
+            ret = ESP_ERR_NOT_SUPPORTED;
+            goto out;
+        }
+        const bool short_list = (entry->format_type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL &&
+                                 entry->data_entries_count < entry->range_length);
+        if (short_list || entry->data_offset > *length || size > *length - entry->data_offset) {
+            ret = ESP_ERR_INVALID_SIZE;
+            goto out;
+        }
+        lists_size += (size + 3) & ~3;
+    }
+
+    font->cmaps = heap_caps_calloc(1, count * sizeof(font_cmap_t) + lists_size, FONT_CAPS);
+    if (font->cmaps == NULL) {
+        ret = ESP_ERR_NO_MEM;
+        goto out;
+    }
+    font->cmap_count = count;
+    uint8_t *list = (uint8_t *)&font->cmaps[count];
+    for (uint32_t i = 0; i < count && ret == ESP_OK; i++) {
+        const font_cmap_entry_t *entry = &entries[i];
+        font_cmap_t *cmap = &font->cmaps[i];
+        cmap->range_start = entry->range_start;
+        cmap->range_length = entry->range_length;
+        cmap->glyph_id_start = entry->glyph_id_start;
+        cmap->type = entry->format_type;
+
+        /* Sparse full maps are the code point list followed by the glyph ID offsets */
+        uint32_t size = 0;
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            size = entry->data_entries_count;
+            cmap->glyph_id_ofs = list;
+        } else if (cmap->type != LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            cmap->list_length = entry->data_entries_count;
+            cmap->unicode_list = (const uint16_t *)list;
+            size = cmap->list_length * sizeof(uint16_t);
+            if (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+                cmap->glyph_id_ofs = list + size;
+                size *= 2;
+            }
+        }
+        ret = bsp_font_read(font, start + entry->data_offset, list, size);
+        list += (size + 3) & ~3;
+    }
+
+out:
+    heap_caps_free(entries);
+    return ret;
+}
+
+/* Offset of glyph i in the glyf section */
+static uint32_t bsp_font_loca(const uint8_t *loca, uint32_t item, uint32_t i)
+{
+    if (item == sizeof(uint16_t)) {
+        uint16_t offset;
+        memcpy(&offset, loca + i * item, sizeof(offset));
+        return offset;
+    }
+    uint32_t offset;
+    memcpy(&offset, loca + i * item, sizeof(offset));
+    return offset;
+}
+
+/* Metrics and bitmap location of every glyph, the bitmaps stay where they are */
+static esp_err_t bsp_font_load_glyphs(bsp_font_t *font, const font_head_t *head, uint32_t loca_start)
+{
+    uint32_t loca_length = 0;
+    uint32_t glyf_length = 0;
+    uint32_t count = 0;
+    esp_err_t ret = bsp_font_section(font, loca_start, "loca", &loca_length);
+    if (ret == ESP_OK) {
+        ret = bsp_font_read(font, loca_start + sizeof(font_label_t), &count, sizeof(count));
+    }
+    const uint32_t glyf_start = loca_start + loca_length;
+    if (ret == ESP_OK) {
+        ret = bsp_font_section(font, glyf_start, "glyf", &glyf_length);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    const uint32_t table = sizeof(font_label_t) + sizeof(count);
+    const uint32_t item = head->index_to_loc_format ? sizeof(uint32_t) : sizeof(uint16_t);
+    if (count == 0 || loca_length < table || count > (loca_length - table) / item) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint8_t *loca = heap_caps_malloc(count * item, FONT_CAPS);
+    font->glyphs = heap_caps_calloc(count, sizeof(font_glyph_t), FONT_CAPS);
+    if (loca == NULL || font->glyphs == NULL) {
+        ret = ESP_ERR_NO_MEM;
+        goto out;
+    }
+    ret = bsp_font_read(font, loca_start + table, loca, count * item);
+    if (ret != ESP_OK) {
+        goto out;
+    }
+
+    /* A record is the adv_w, ofs_x, ofs_y, box_w and box_h bit fields, the bitmap follows the last bit */
+    const uint32_t nbits = head->advance_width_bits + 2 * head->xy_bits + 2 * head->wh_bits;
+    font->shift = nbits % 8;
+    uint32_t raw_max = 0;
+    for (uint32_t i = 1; i < count; i++) {  // Glyph 0 is reserved, it stays empty
+        const uint32_t offset = bsp_font_loca(loca, item, i);
+        const uint32_t next = (i + 1 < count) ? bsp_font_loca(loca, item, i + 1) : glyf_length;
+        if (offset < sizeof(font_label_t) || next < offset || next > glyf_length || (next - offset) * 8 < nbits) {
+            ret = ESP_ERR_INVALID_SIZE;
+            goto out;
+        }
+
+        uint8_t record[FONT_GLYPH_HEADER_MAX] = { 0 };
+        ret = bsp_font_read(font, glyf_start + offset, record, (nbits + 7) / 8);
+        if (ret != ESP_OK) {
+            goto out;
+        }
+        font_glyph_t *glyph = &font->glyphs[i];
+        uint32_t pos = 0;
+        glyph->adv_w = head->advance_width_bits ? bsp_font_field(record, &pos, head->advance_width_bits) :
+                       head->default_advance_width;
+        glyph->adv_w *= (head->advance_width_format == 0) ? 16 : 1;
+        glyph->ofs_x = bsp_font_field_signed(record, &pos, head->xy_bits);
+        glyph->ofs_y = bsp_font_field_signed(record, &pos, head->xy_bits);
+        glyph->box_w = bsp_font_field(record, &pos, head->wh_bits);
+        glyph->box_h = bsp_font_field(record, &pos, head->wh_bits);
+        if (glyph->box_w * glyph->box_h == 0) {
+            continue;
+        }
+        glyph->offset = glyf_start + offset + nbits / 8;
+        glyph->size = next - offset - nbits / 8;
+        if (font->compression == LV_FONT_FMT_TXT_PLAIN &&
+                glyph->size < (glyph->box_w * glyph->box_h * font->bpp + 7u) / 8) {
+            ret = ESP_ERR_INVALID_SIZE;
+            goto out;
+        }
+        raw_max = LV_MAX(raw_max, glyph->size);
+    }
+    font->glyph_count = count;
+
+    if (font->file && raw_max > 0) {
+        font->raw = heap_caps_malloc(raw_max, FONT_CAPS);
+        ret = font->raw ? ESP_OK : ESP_ERR_NO_MEM;
+    }
+
+out:
+    heap_caps_free(loca);
+    return ret;
+}
+
+static esp_err_t bsp_font_open(bsp_font_t *font, const char *path)
+{
+    if (path[0] == '/') {
+        font->file = fopen(path, "rb");
+        if (font->file == NULL) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        setvbuf(font->file, NULL, _IOFBF, FONT_FILE_BUFFER);
+        const long size = (fseek(font->file, 0, SEEK_END) == 0) ? ftell(font->file) : -1;
+        if (size < 0) {
+            return ESP_FAIL;
+        }
+        font->size = size;
+
+        /* A font that fits is read once here, so drawing never waits for the card */
+        if (size == 0 || size > FONT_PRELOAD_BYTES) {
+            return ESP_OK;
+        }
+        font->preload = heap_caps_malloc(size, FONT_CAPS);
+        if (font->preload == NULL) {
+            ESP_LOGW(TAG, "No memory to preload %s, glyphs are read when drawn", path);
+            return ESP_OK;
+        }
+        if (fseek(font->file, 0, SEEK_SET) != 0 || fread(font->preload, 1, size, font->file) != (size_t)size) {
+            return ESP_FAIL;
+        }
+        fclose(font->file);
+        font->file = NULL;
+        font->data = font->preload;
+        return ESP_OK;
+    }
+#if CONFIG_BSP_ASSETS
+    const void *data;
+    size_t size;
+    esp_err_t ret = bsp_assets_get_data(path, &data, &size);
+    font->data = data;
+    font->size = size;
+    return ret;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+static esp_err_t bsp_font_parse(bsp_font_t *font)
+{
+    font_head_t head;
+    uint32_t head_length = 0;
+    uint32_t cmap_length = 0;
+    esp_err_t ret = bsp_font_load_head(font, &head, &head_length);
+    if (ret == ESP_OK) {
+        ret = bsp_font_load_cmaps(font, head_length, &cmap_length);
+    }
+    if (ret == ESP_OK) {
+        ret = bsp_font_load_glyphs(font, &head, head_length + cmap_length);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    lv_font_t *lv_font = &font->font;
+    lv_font->get_glyph_dsc = bsp_font_get_glyph_dsc;
+    lv_font->get_glyph_bitmap = bsp_font_get_glyph_bitmap;
+    lv_font->line_height = head.ascent - head.descent;
+    lv_font->base_line = -head.descent;
+    lv_font->subpx = head.subpixels_mode;
+    lv_font->underline_position = head.underline_position;
+    lv_font->underline_thickness = head.underline_thickness;
+    lv_font->dsc = font;
+    return ESP_OK;
+}
+
+static void bsp_font_release(bsp_font_t *font)
+{
+    if (font->file) {
+        fclose(font->file);
+    }
+    heap_caps_free(font->cmaps);
+    heap_caps_free(font->glyphs);
+    heap_caps_free(font->raw);
+    heap_caps_free(font->preload);
+    heap_caps_free(font);
+}
+
+/*******************************************************************************
+* Public API
+*******************************************************************************/
+
+lv_font_t *bsp_font_load(const char *path)
+{
+    BSP_NULL_CHECK(path, NULL);
+    bsp_font_t *font = heap_caps_calloc(1, sizeof(bsp_font_t), FONT_CAPS);
+    BSP_NULL_CHECK(font, NULL);
+
+    esp_err_t ret = bsp_font_open(font, path);
+    if (ret == ESP_OK) {
+        ret = bsp_font_parse(font);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Font %s not loaded: %s", path, esp_err_to_name(ret));
+        bsp_font_release(font);
+        return NULL;
+    }
+
+    portENTER_CRITICAL(&s_font.lock);
+    s_font.stats.fonts++;
+    portEXIT_CRITICAL(&s_font.lock);
+    ESP_LOGI(TAG, "Loaded %s: %d px lines, %" PRIu32 " glyphs, %u bpp%s%s", path, font->font.line_height,
+             font->glyph_count, font->bpp, font->compression == LV_FONT_FMT_TXT_PLAIN ? "" : ", compressed",
+             font->preload ? ", preloaded" : "");
+    return &font->font;
+}
+
+void bsp_font_free(lv_font_t *lv_font)
+{
+    if (lv_font == NULL) {
+        return;
+    }
+    bsp_font_t *font = (bsp_font_t *)lv_font->dsc;
+    for (font_entry_t *entry = s_font.oldest, *newer; entry; entry = newer) {
+        newer = entry->newer;
+        if (entry->font == font) {
+            bsp_font_cache_remove(entry, false);
+        }
+    }
+    portENTER_CRITICAL(&s_font.lock);
+    s_font.stats.fonts--;
+    portEXIT_CRITICAL(&s_font.lock);
+    bsp_font_release(font);
+}
+
+esp_err_t bsp_font_get_stats(bsp_font_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+    portENTER_CRITICAL(&s_font.lock);
+    *stats = s_font.stats;
+    portEXIT_CRITICAL(&s_font.lock);
+    return ESP_OK;
+}
+
+void bsp_font_reset_stats(void)
+{
+    portENTER_CRITICAL(&s_font.lock);
+    const bsp_font_stats_t kept = {
+        .fonts = s_font.stats.fonts,
+        .glyphs = s_font.stats.glyphs,
+        .cache_bytes = s_font.stats.cache_bytes,
+    };
+    s_font.stats = kept;
+    portEXIT_CRITICAL(&s_font.lock);
+}
+#endif // CONFIG_BSP_FONT
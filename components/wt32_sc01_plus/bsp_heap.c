@@ -0,0 +1,179 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_HEAP_TELEMETRY
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_lv_mem.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_heap";
+
+/* Warnings are repeated with the log period, or once a minute without the log */
+#if CONFIG_BSP_HEAP_TELEMETRY_LOG_PERIOD_S
+#define HEAP_WARN_PERIOD_US     (CONFIG_BSP_HEAP_TELEMETRY_LOG_PERIOD_S * 1000000LL)
+#else
+#define HEAP_WARN_PERIOD_US     (60 * 1000000LL)
+#endif
+
+static const uint32_t bsp_heap_caps[BSP_HEAP_REGION_MAX] = {
+    [BSP_HEAP_INTERNAL] = MALLOC_CAP_INTERNAL,
+    [BSP_HEAP_DMA]      = MALLOC_CAP_DMA,
+    [BSP_HEAP_SPIRAM]   = MALLOC_CAP_SPIRAM,
+};
+
+static const char *const bsp_heap_names[BSP_HEAP_REGION_MAX] = {
+    [BSP_HEAP_INTERNAL] = "internal",
+    [BSP_HEAP_DMA]      = "DMA",
+    [BSP_HEAP_SPIRAM]   = "PSRAM",
+};
+
+static struct {
+    portMUX_TYPE lock;
+    bsp_heap_stats_t stats;
+    esp_timer_handle_t timer;
+    int64_t last_log_us;
+    int64_t last_warn_us;
+} s_heap = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static uint8_t bsp_heap_frag_pct(size_t free, size_t largest)
+{
+    return free ? 100 - (uint8_t)((uint64_t)largest * 100 / free) : 0;
+}
+
+static void bsp_heap_sample(void)
+{
+    multi_heap_info_t info;
+    bsp_heap_region_stats_t region[BSP_HEAP_REGION_MAX];
+    for (int i = 0; i < BSP_HEAP_REGION_MAX; i++) {
+        heap_caps_get_info(&info, bsp_heap_caps[i]);
+        region[i].total = info.total_free_bytes + info.total_allocated_bytes;
+        region[i].free = info.total_free_bytes;
+        region[i].largest_block = info.largest_free_block;
+        region[i].min_free = info.minimum_free_bytes;
+        region[i].free_blocks = info.free_blocks;
+        region[i].frag_pct = bsp_heap_frag_pct(info.total_free_bytes, info.largest_free_block);
+    }
+
+    bsp_heap_lvgl_stats_t lvgl = { 0 };
+#if CONFIG_BSP_HEAP_TELEMETRY_LVGL
+    bsp_lv_mem_get_stats(&lvgl);
+    heap_caps_get_info(&info, MALLOC_CAP_DEFAULT);
+    lvgl.frag_pct = bsp_heap_frag_pct(info.total_free_bytes, info.largest_free_block);
+#endif
+
+    portENTER_CRITICAL(&s_heap.lock);
+    for (int i = 0; i < BSP_HEAP_REGION_MAX; i++) {
+        const size_t min_largest = s_heap.stats.region[i].min_largest_block;
+        region[i].min_largest_block = s_heap.stats.samples == 0 ? region[i].largest_block :
+                                      MIN(min_largest, region[i].largest_block);
+        s_heap.stats.region[i] = region[i];
+    }
+    s_heap.stats.lvgl = lvgl;
+    s_heap.stats.samples++;
+    portEXIT_CRITICAL(&s_heap.lock);
+}
+
+#if CONFIG_BSP_HEAP_TELEMETRY_LOG_PERIOD_S
+static void bsp_heap_log(const bsp_heap_stats_t *stats)
+{
+    for (int i = 0; i < BSP_HEAP_REGION_MAX; i++) {
+        const bsp_heap_region_stats_t *r = &stats->region[i];
+        if (r->total == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "%-8s: free %7u / %7u B, largest %7u B, min free %7u B, min largest %7u B, frag %3u %%",
+                 bsp_heap_names[i], (unsigned)r->free, (unsigned)r->total, (unsigned)r->largest_block,
+                 (unsigned)r->min_free, (unsigned)r->min_largest_block, r->frag_pct);
+    }
+#if CONFIG_BSP_HEAP_TELEMETRY_LVGL
+    const bsp_heap_lvgl_stats_t *l = &stats->lvgl;
+    ESP_LOGI(TAG, "LVGL    : %u blocks, %u B used, %u B peak, %u allocs, %u failed, frag %3u %%",
+             (unsigned)l->blocks, (unsigned)l->used, (unsigned)l->peak, (unsigned)l->allocs, (unsigned)l->failures,
+             l->frag_pct);
+#endif
+#if CONFIG_BSP_LV_MEM_POOL
+    bsp_lv_mem_class_stats_t cls[BSP_LV_MEM_CLASSES];
+    bsp_lv_mem_get_class_stats(cls);
+    for (int i = 0; i < BSP_LV_MEM_CLASSES; i++) {
+        ESP_LOGI(TAG, "  %4u B  : %5u / %5u blocks used, peak %5u, overflow %u%s", (unsigned)cls[i].size,
+                 (unsigned)cls[i].used, (unsigned)cls[i].blocks, (unsigned)cls[i].peak, (unsigned)cls[i].overflow,
+                 cls[i].spiram ? ", PSRAM" : "");
+    }
+#endif
+}
+#endif
+
+static void bsp_heap_timer_cb(void *arg)
+{
+    bsp_heap_stats_t stats;
+    bsp_heap_get_stats(&stats);
+
+#if CONFIG_BSP_HEAP_TELEMETRY_LOG_PERIOD_S
+    const int64_t now = esp_timer_get_time();
+    if (now - s_heap.last_log_us >= CONFIG_BSP_HEAP_TELEMETRY_LOG_PERIOD_S * 1000000LL) {
+        s_heap.last_log_us = now;
+        bsp_heap_log(&stats);
+    }
+#endif
+
+#if CONFIG_BSP_HEAP_TELEMETRY_DMA_WARN_BLOCK
+    const int64_t warn_now = esp_timer_get_time();
+    const size_t largest = stats.region[BSP_HEAP_DMA].largest_block;
+    if (largest < CONFIG_BSP_HEAP_TELEMETRY_DMA_WARN_BLOCK &&
+            (s_heap.last_warn_us == 0 || warn_now - s_heap.last_warn_us >= HEAP_WARN_PERIOD_US)) {
+        s_heap.last_warn_us = warn_now;
+        ESP_LOGW(TAG, "Largest DMA block %u B is below %u B (%u B free, frag %u %%)", (unsigned)largest,
+                 CONFIG_BSP_HEAP_TELEMETRY_DMA_WARN_BLOCK, (unsigned)stats.region[BSP_HEAP_DMA].free,
+                 stats.region[BSP_HEAP_DMA].frag_pct);
+    }
+#endif
+}
+
+esp_err_t bsp_heap_get_stats(bsp_heap_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+
+    bsp_heap_sample();
+    portENTER_CRITICAL(&s_heap.lock);
+    *stats = s_heap.stats;
+    portEXIT_CRITICAL(&s_heap.lock);
+    return ESP_OK;
+}
+
+esp_err_t bsp_heap_telemetry_start(void)
+{
+    if (s_heap.timer) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* First log right away, a baseline to compare the later ones with */
+    bsp_heap_stats_t stats;
+    bsp_heap_get_stats(&stats);
+    s_heap.last_log_us = esp_timer_get_time();
+#if CONFIG_BSP_HEAP_TELEMETRY_LOG_PERIOD_S
+    bsp_heap_log(&stats);
+#endif
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = bsp_heap_timer_cb,
+        .name = "heap_telemetry",
+    };
+    BSP_ERROR_CHECK_RETURN_ERR(esp_timer_create(&timer_args, &s_heap.timer));
+    const esp_err_t ret = esp_timer_start_periodic(s_heap.timer, CONFIG_BSP_HEAP_TELEMETRY_PERIOD_MS * 1000ULL);
+    if (ret != ESP_OK) {
+        /* Leave no timer behind, so a later call can start again */
+        esp_timer_delete(s_heap.timer);
+        s_heap.timer = NULL;
+    }
+    BSP_ERROR_CHECK_RETURN_ERR(ret);
+    return ESP_OK;
+}
+#endif // CONFIG_BSP_HEAP_TELEMETRY
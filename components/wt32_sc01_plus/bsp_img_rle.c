@@ -0,0 +1,399 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_IMG_RLE
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#if CONFIG_BSP_IMG_RLE_CACHE
+#include "esp_heap_caps.h"
+#endif
+#if CONFIG_BSP_IMG_RLE_BENCHMARK
+#include "esp_timer.h"
+#endif
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_img_rle.h"
+#include "bsp_err_check.h"
+
+#if LV_COLOR_DEPTH != 16
+#error "BSP_IMG_CF_RLE images decode to RGB565, set LV_COLOR_DEPTH to 16"
+#endif
+
+static const char *TAG = "SC01_Plus_img";
+
+#define RLE_REPEAT              (0x80)
+#define RLE_COUNT_MASK          (0x7F)
+
+#if CONFIG_BSP_IMG_RLE_CACHE
+#define RLE_CACHE_BYTES         (CONFIG_BSP_IMG_RLE_CACHE_SIZE_KB * 1024)
+
+/* Image tracked by the cache, decoded into PSRAM once it was opened often enough */
+typedef struct {
+    const lv_img_dsc_t *src;    // NULL when the slot is free
+    uint8_t *pixels;            // Decoded image, NULL while not cached
+    uint32_t size;
+    uint32_t opens;
+    uint32_t refs;              // Open decoder descriptors drawing from pixels
+    uint32_t last_open;         // s_img.clock at the last open
+} bsp_img_rle_entry_t;
+#endif
+
+/* Decoder callbacks run in the LVGL task, everything below is protected by the display lock */
+static struct {
+    lv_img_decoder_t *decoder;
+    bsp_img_rle_stats_t stats;
+#if CONFIG_BSP_IMG_RLE_CACHE
+    bsp_img_rle_entry_t cache[CONFIG_BSP_IMG_RLE_CACHE_ENTRIES];
+    uint32_t clock;
+    uint32_t min_opens;         // CONFIG_BSP_IMG_RLE_CACHE_MIN_OPENS, changed by the benchmark
+#endif
+} s_img = {
+#if CONFIG_BSP_IMG_RLE_CACHE
+    .min_opens = CONFIG_BSP_IMG_RLE_CACHE_MIN_OPENS,
+#endif
+};
+
+static inline const bsp_img_rle_header_t *bsp_img_rle_header(const lv_img_dsc_t *img)
+{
+    return (const bsp_img_rle_header_t *)img->data;
+}
+
+/* Decode len pixels of line y starting at pixel x */
+static void bsp_img_rle_decode_line(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *dst)
+{
+    const bsp_img_rle_header_t *rle = bsp_img_rle_header(img);
+    const size_t px_size = rle->px_size;
+    const uint8_t *src = img->data + rle->line_offset[y];
+    const uint8_t *end = (y + 1 < img->header.h) ? img->data + rle->line_offset[y + 1] : img->data + img->data_size;
+
+    while (len > 0 && src < end) {
+        const bool repeat = src[0] & RLE_REPEAT;
+        lv_coord_t count = (src[0] & RLE_COUNT_MASK) + 1;
+        const uint8_t *px = src + 1;
+        src = px + (repeat ? px_size : count * px_size);
+        if (src > end) {
+            break;      // Truncated packet
+        }
+        if (x >= count) {
+            x -= count;
+            continue;
+        }
+        count -= x;
+        if (count > len) {
+            count = len;
+        }
+        if (repeat) {
+            for (lv_coord_t i = 0; i < count; i++) {
+                memcpy(dst, px, px_size);
+                dst += px_size;
+            }
+        } else {
+            memcpy(dst, px + x * px_size, count * px_size);
+            dst += count * px_size;
+        }
+        x = 0;
+        len -= count;
+    }
+    if (len > 0) {
+        memset(dst, 0, len * px_size);   // Corrupt line, the rest is transparent or black
+    }
+}
+
+#if CONFIG_BSP_IMG_RLE_CACHE
+static void bsp_img_rle_cache_free(bsp_img_rle_entry_t *entry)
+{
+    s_img.stats.cache_bytes -= entry->size;
+    heap_caps_free(entry->pixels);
+    entry->pixels = NULL;
+    entry->size = 0;
+}
+
+/* Least recently opened entry that LVGL does not draw from, with or without pixels */
+static bsp_img_rle_entry_t *bsp_img_rle_cache_lru(bool with_pixels, const bsp_img_rle_entry_t *keep)
+{
+    bsp_img_rle_entry_t *lru = NULL;
+    for (size_t i = 0; i < CONFIG_BSP_IMG_RLE_CACHE_ENTRIES; i++) {
+        bsp_img_rle_entry_t *entry = &s_img.cache[i];
+        if (entry == keep || entry->refs > 0 || (with_pixels && entry->pixels == NULL)) {
+            continue;
+        }
+        if (lru == NULL || s_img.clock - entry->last_open > s_img.clock - lru->last_open) {
+            lru = entry;
+        }
+    }
+    return lru;
+}
+
+static bsp_img_rle_entry_t *bsp_img_rle_cache_find(const lv_img_dsc_t *img)
+{
+    bsp_img_rle_entry_t *free_entry = NULL;
+    for (size_t i = 0; i < CONFIG_BSP_IMG_RLE_CACHE_ENTRIES; i++) {
+        if (s_img.cache[i].src == img) {
+            return &s_img.cache[i];
+        }
+        if (s_img.cache[i].src == NULL && free_entry == NULL) {
+            free_entry = &s_img.cache[i];
+        }
+    }
+
+    /* Start tracking the image in a free slot or in place of the least recently opened one */
+    bsp_img_rle_entry_t *entry = free_entry ? free_entry : bsp_img_rle_cache_lru(false, NULL);
+    if (entry == NULL) {
+        return NULL;    // Every tracked image is being drawn from the cache
+    }
+    if (entry->pixels) {
+        bsp_img_rle_cache_free(entry);
+        s_img.stats.cache_evictions++;
+    }
+    memset(entry, 0, sizeof(*entry));
+    entry->src = img;
+    return entry;
+}
+
+static void bsp_img_rle_cache_fill(bsp_img_rle_entry_t *entry)
+{
+    const lv_img_dsc_t *img = entry->src;
+    const size_t stride = img->header.w * bsp_img_rle_header(img)->px_size;
+    const uint32_t size = stride * img->header.h;
+    if (size > RLE_CACHE_BYTES) {
+        return;
+    }
+    while (s_img.stats.cache_bytes + size > RLE_CACHE_BYTES) {
+        bsp_img_rle_entry_t *lru = bsp_img_rle_cache_lru(true, entry);
+        if (lru == NULL) {
+            return;     // The rest of the cache is being drawn from
+        }
+        bsp_img_rle_cache_free(lru);
+        s_img.stats.cache_evictions++;
+    }
+
+    uint8_t *pixels = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (pixels == NULL) {
+        ESP_LOGD(TAG, "No PSRAM for a %" PRIu32 " B image", size);
+        return;
+    }
+    for (lv_coord_t y = 0; y < img->header.h; y++) {
+        bsp_img_rle_decode_line(img, 0, y, img->header.w, pixels + y * stride);
+    }
+    entry->pixels = pixels;
+    entry->size = size;
+    s_img.stats.cache_bytes += size;
+    s_img.stats.cache_fills++;
+}
+#endif
+
+static lv_res_t bsp_img_rle_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+        return LV_RES_INV;
+    }
+    const lv_img_dsc_t *img = src;
+    if (img->header.cf != BSP_IMG_CF_RLE) {
+        return LV_RES_INV;
+    }
+
+    const bsp_img_rle_header_t *rle = bsp_img_rle_header(img);
+    if (img->data_size < sizeof(*rle) + img->header.h * sizeof(rle->line_offset[0]) ||
+            rle->magic != BSP_IMG_RLE_MAGIC || (rle->px_size != sizeof(lv_color_t) && rle->px_size != LV_IMG_PX_SIZE_ALPHA_BYTE)) {
+        ESP_LOGD(TAG, "Invalid RLE image %p", src);
+        return LV_RES_INV;
+    }
+
+    header->always_zero = 0;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->cf = (rle->px_size == LV_IMG_PX_SIZE_ALPHA_BYTE) ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+static lv_res_t bsp_img_rle_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    /* No img_data: LVGL draws the image line by line through bsp_img_rle_read_line() */
+    dsc->img_data = NULL;
+    dsc->user_data = NULL;
+    s_img.stats.opens++;
+
+#if CONFIG_BSP_IMG_RLE_CACHE
+    bsp_img_rle_entry_t *entry = bsp_img_rle_cache_find(dsc->src);
+    if (entry == NULL) {
+        return LV_RES_OK;
+    }
+    entry->opens++;
+    entry->last_open = ++s_img.clock;
+    if (entry->pixels) {
+        s_img.stats.cache_hits++;
+    } else if (entry->opens >= s_img.min_opens) {
+        bsp_img_rle_cache_fill(entry);
+    }
+    if (entry->pixels) {
+        entry->refs++;
+        dsc->img_data = entry->pixels;
+        dsc->user_data = entry;
+    }
+#endif
+    return LV_RES_OK;
+}
+
+static lv_res_t bsp_img_rle_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc, lv_coord_t x, lv_coord_t y,
+                                      lv_coord_t len, uint8_t *buf)
+{
+    const lv_img_dsc_t *img = dsc->src;
+    if (y < 0 || y >= img->header.h || x < 0 || x + len > img->header.w) {
+        return LV_RES_INV;
+    }
+    bsp_img_rle_decode_line(img, x, y, len, buf);
+    s_img.stats.lines++;
+    return LV_RES_OK;
+}
+
+static void bsp_img_rle_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+#if CONFIG_BSP_IMG_RLE_CACHE
+    bsp_img_rle_entry_t *entry = dsc->user_data;
+    if (entry) {
+        entry->refs--;
+        dsc->user_data = NULL;
+    }
+#endif
+    dsc->img_data = NULL;
+}
+
+esp_err_t bsp_img_rle_get_stats(bsp_img_rle_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+
+    bsp_display_lock(0);
+    *stats = s_img.stats;
+    bsp_display_unlock();
+    return ESP_OK;
+}
+
+void bsp_img_rle_cache_drop(void)
+{
+#if CONFIG_BSP_IMG_RLE_CACHE
+    bsp_display_lock(0);
+    for (size_t i = 0; i < CONFIG_BSP_IMG_RLE_CACHE_ENTRIES; i++) {
+        if (s_img.cache[i].pixels && s_img.cache[i].refs == 0) {
+            bsp_img_rle_cache_free(&s_img.cache[i]);
+        }
+        if (s_img.cache[i].pixels == NULL) {
+            s_img.cache[i].src = NULL;
+        }
+    }
+    bsp_display_unlock();
+#endif
+}
+
+esp_err_t bsp_img_rle_init(void)
+{
+    if (s_img.decoder) {
+        return ESP_OK;
+    }
+
+    bsp_display_lock(0);
+    s_img.decoder = lv_img_decoder_create();
+    if (s_img.decoder) {
+        lv_img_decoder_set_info_cb(s_img.decoder, bsp_img_rle_info);
+        lv_img_decoder_set_open_cb(s_img.decoder, bsp_img_rle_open);
+        lv_img_decoder_set_read_line_cb(s_img.decoder, bsp_img_rle_read_line);
+        lv_img_decoder_set_close_cb(s_img.decoder, bsp_img_rle_close);
+    }
+    bsp_display_unlock();
+    BSP_NULL_CHECK(s_img.decoder, ESP_ERR_NO_MEM);
+
+#if CONFIG_BSP_IMG_RLE_CACHE
+    ESP_LOGI(TAG, "RLE image decoder, images opened %d times are cached in %d kB of PSRAM",
+             CONFIG_BSP_IMG_RLE_CACHE_MIN_OPENS, CONFIG_BSP_IMG_RLE_CACHE_SIZE_KB);
+#else
+    ESP_LOGI(TAG, "RLE image decoder");
+#endif
+    return ESP_OK;
+}
+
+#if CONFIG_BSP_IMG_RLE_BENCHMARK
+/* Average time to draw img into the canvas, LVGL opens the image again for the first draw */
+static uint32_t bsp_img_rle_bench_draw(lv_obj_t *canvas, const lv_img_dsc_t *img)
+{
+    lv_draw_img_dsc_t draw_dsc;
+    lv_draw_img_dsc_init(&draw_dsc);
+    lv_img_cache_invalidate_src(img);
+
+    const int64_t start = esp_timer_get_time();
+    for (int i = 0; i < CONFIG_BSP_IMG_RLE_BENCHMARK_DRAWS; i++) {
+        lv_canvas_draw_img(canvas, 0, 0, img, &draw_dsc);
+    }
+    const uint32_t draw_us = (esp_timer_get_time() - start) / CONFIG_BSP_IMG_RLE_BENCHMARK_DRAWS;
+
+    lv_img_cache_invalidate_src(img);
+    return draw_us;
+}
+
+static esp_err_t bsp_img_rle_bench_image(const bsp_img_rle_bench_image_t *image, bsp_img_rle_bench_result_t *result)
+{
+    const lv_img_header_t *header = &image->raw->header;
+    uint8_t *buf = malloc(LV_CANVAS_BUF_SIZE_TRUE_COLOR(header->w, header->h));
+    BSP_NULL_CHECK(buf, ESP_ERR_NO_MEM);
+
+    lv_obj_t *canvas = lv_canvas_create(lv_layer_top());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_buffer(canvas, buf, header->w, header->h, LV_IMG_CF_TRUE_COLOR);
+
+    result->raw_bytes = image->raw->data_size;
+    result->rle_bytes = image->rle->data_size;
+    result->raw_us = bsp_img_rle_bench_draw(canvas, image->raw);
+#if CONFIG_BSP_IMG_RLE_CACHE
+    /* Line by line: the image must not come from the cache */
+    bsp_img_rle_cache_drop();
+    s_img.min_opens = UINT32_MAX;
+    result->rle_us = bsp_img_rle_bench_draw(canvas, image->rle);
+    /* Cached: decoded into PSRAM on the first open */
+    s_img.min_opens = 1;
+    result->cached_us = bsp_img_rle_bench_draw(canvas, image->rle);
+    s_img.min_opens = CONFIG_BSP_IMG_RLE_CACHE_MIN_OPENS;
+#else
+    result->rle_us = bsp_img_rle_bench_draw(canvas, image->rle);
+    result->cached_us = 0;
+#endif
+
+    lv_obj_del(canvas);
+    free(buf);
+    return ESP_OK;
+}
+
+esp_err_t bsp_img_rle_benchmark(const bsp_img_rle_bench_image_t *images, size_t count, bsp_img_rle_bench_result_t *results)
+{
+    BSP_NULL_CHECK(images, ESP_ERR_INVALID_ARG);
+    for (size_t i = 0; i < count; i++) {
+        BSP_NULL_CHECK(images[i].raw, ESP_ERR_INVALID_ARG);
+        BSP_NULL_CHECK(images[i].rle, ESP_ERR_INVALID_ARG);
+        if (images[i].raw->header.w != images[i].rle->header.w || images[i].raw->header.h != images[i].rle->header.h) {
+            ESP_LOGE(TAG, "%s: raw and RLE images differ in size", images[i].name);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    esp_err_t ret = ESP_OK;
+    ESP_LOGI(TAG, "Image draw benchmark: %d draws per image and format", CONFIG_BSP_IMG_RLE_BENCHMARK_DRAWS);
+    ESP_LOGI(TAG, " image        | raw [B] | RLE [B] | raw [us] | RLE [us] | cached [us]");
+    bsp_display_lock(0);
+    for (size_t i = 0; i < count; i++) {
+        bsp_img_rle_bench_result_t result = { 0 };
+        ret = bsp_img_rle_bench_image(&images[i], &result);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, " %-12s | failed (%s)", images[i].name, esp_err_to_name(ret));
+            break;
+        }
+        ESP_LOGI(TAG, " %-12s | %7" PRIu32 " | %7" PRIu32 " | %8" PRIu32 " | %8" PRIu32 " | %11" PRIu32, images[i].name,
+                 result.raw_bytes, result.rle_bytes, result.raw_us, result.rle_us, result.cached_us);
+        if (results) {
+            results[i] = result;
+        }
+    }
+    bsp_display_unlock();
+
+    return ret;
+}
+#endif // CONFIG_BSP_IMG_RLE_BENCHMARK
+#endif // CONFIG_BSP_IMG_RLE
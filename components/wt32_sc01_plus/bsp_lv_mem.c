@@ -0,0 +1,326 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_LV_MEM
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_memory_utils.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp/lv_mem.h"
+#include "bsp_lv_mem.h"
+
+#define LV_MEM_CLASS_HEAP       (0xFFFF)    // Block comes from the heap, not from a pool
+
+/* Keeps the 8-byte alignment of the block behind it */
+typedef struct {
+    uint32_t size;          // Requested size
+    uint16_t cls;           // Size class or LV_MEM_CLASS_HEAP
+    uint16_t reserved;
+} bsp_lv_mem_hdr_t;
+
+#if CONFIG_BSP_LV_MEM_POOL
+static const char *TAG = "SC01_Plus_lv_mem";
+
+typedef struct bsp_lv_mem_free {
+    struct bsp_lv_mem_free *next;
+} bsp_lv_mem_free_t;
+
+typedef struct {
+    bsp_lv_mem_free_t *free;    // Free blocks, linked through their header
+    bsp_lv_mem_class_stats_t stats;
+} bsp_lv_mem_class_t;
+
+static const uint16_t bsp_lv_mem_class_size[BSP_LV_MEM_CLASSES] = { 16, 32, 64, 128, 256, 512, 1024, 2048 };
+
+#if CONFIG_BSP_LV_MEM_POOL_STATIC
+static const uint16_t bsp_lv_mem_class_blocks[BSP_LV_MEM_CLASSES] = {
+    CONFIG_BSP_LV_MEM_POOL_BLOCKS_16,
+    CONFIG_BSP_LV_MEM_POOL_BLOCKS_32,
+    CONFIG_BSP_LV_MEM_POOL_BLOCKS_64,
+    CONFIG_BSP_LV_MEM_POOL_BLOCKS_128,
+    CONFIG_BSP_LV_MEM_POOL_BLOCKS_256,
+    CONFIG_BSP_LV_MEM_POOL_BLOCKS_512,
+    CONFIG_BSP_LV_MEM_POOL_BLOCKS_1024,
+    CONFIG_BSP_LV_MEM_POOL_BLOCKS_2048,
+};
+#endif
+#endif // CONFIG_BSP_LV_MEM_POOL
+
+static struct {
+    portMUX_TYPE lock;
+    uint32_t blocks;
+    uint32_t allocs;
+    uint32_t failures;
+    size_t used;
+    size_t peak;
+#if CONFIG_BSP_LV_MEM_POOL
+    bool ready;
+    bsp_lv_mem_class_t cls[BSP_LV_MEM_CLASSES];
+#endif
+} s_lv_mem = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+/* Called with the lock held */
+static void bsp_lv_mem_used_add(size_t size)
+{
+    s_lv_mem.used += size;
+    if (s_lv_mem.used > s_lv_mem.peak) {
+        s_lv_mem.peak = s_lv_mem.used;
+    }
+}
+
+#if CONFIG_BSP_LV_MEM_POOL
+static size_t bsp_lv_mem_stride(int cls)
+{
+    return sizeof(bsp_lv_mem_hdr_t) + bsp_lv_mem_class_size[cls];
+}
+
+/* Smallest class for the size, -1 for sizes only the heap serves */
+static int bsp_lv_mem_class(size_t size)
+{
+    for (int i = 0; i < BSP_LV_MEM_CLASSES; i++) {
+        if (size <= bsp_lv_mem_class_size[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Add blocks to the pool of the class, the memory is never given back */
+static bool bsp_lv_mem_grow(int cls, uint32_t count)
+{
+    if (count == 0) {
+        return false;
+    }
+    const size_t stride = bsp_lv_mem_stride(cls);
+    uint8_t *slab = NULL;
+    if (bsp_lv_mem_class_size[cls] > CONFIG_BSP_LV_MEM_POOL_INTERNAL_MAX) {
+        slab = heap_caps_malloc(count * stride, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (slab == NULL) {
+        slab = heap_caps_malloc(count * stride, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (slab == NULL) {
+        return false;
+    }
+
+    bsp_lv_mem_class_t *c = &s_lv_mem.cls[cls];
+    portENTER_CRITICAL(&s_lv_mem.lock);
+    for (uint32_t i = 0; i < count; i++) {
+        bsp_lv_mem_free_t *block = (bsp_lv_mem_free_t *)(slab + i * stride);
+        block->next = c->free;
+        c->free = block;
+    }
+    c->stats.blocks += count;
+    c->stats.spiram = esp_ptr_external_ram(slab);
+    portEXIT_CRITICAL(&s_lv_mem.lock);
+    return true;
+}
+
+static void bsp_lv_mem_init(void)
+{
+    for (int i = 0; i < BSP_LV_MEM_CLASSES; i++) {
+        s_lv_mem.cls[i].stats.size = bsp_lv_mem_class_size[i];
+    }
+    s_lv_mem.ready = true;
+
+#if CONFIG_BSP_LV_MEM_POOL_STATIC
+    size_t internal = 0;
+    size_t spiram = 0;
+    for (int i = 0; i < BSP_LV_MEM_CLASSES; i++) {
+        if (bsp_lv_mem_class_blocks[i] && !bsp_lv_mem_grow(i, bsp_lv_mem_class_blocks[i])) {
+            ESP_LOGE(TAG, "No memory for %u blocks of %u B", bsp_lv_mem_class_blocks[i], bsp_lv_mem_class_size[i]);
+            continue;
+        }
+        const size_t bytes = bsp_lv_mem_class_blocks[i] * bsp_lv_mem_stride(i);
+        *(s_lv_mem.cls[i].stats.spiram ? &spiram : &internal) += bytes;
+    }
+    ESP_LOGI(TAG, "LVGL pools preallocated: %u B internal, %u B PSRAM", (unsigned)internal, (unsigned)spiram);
+#endif
+}
+
+/* Take a block of the class, NULL when the pool is empty */
+static bsp_lv_mem_hdr_t *bsp_lv_mem_pop(int cls)
+{
+    bsp_lv_mem_class_t *c = &s_lv_mem.cls[cls];
+    portENTER_CRITICAL(&s_lv_mem.lock);
+    bsp_lv_mem_free_t *block = c->free;
+    if (block) {
+        c->free = block->next;
+        c->stats.used++;
+        c->stats.peak = MAX(c->stats.peak, c->stats.used);
+    }
+    portEXIT_CRITICAL(&s_lv_mem.lock);
+    return (bsp_lv_mem_hdr_t *)block;
+}
+
+/* Called with the lock held */
+static void bsp_lv_mem_push(bsp_lv_mem_hdr_t *hdr)
+{
+    bsp_lv_mem_class_t *c = &s_lv_mem.cls[hdr->cls];
+    bsp_lv_mem_free_t *block = (bsp_lv_mem_free_t *)hdr;
+    block->next = c->free;
+    c->free = block;
+    c->stats.used--;
+}
+
+static bsp_lv_mem_hdr_t *bsp_lv_mem_heap_alloc(size_t size)
+{
+#if CONFIG_BSP_LV_MEM_POOL_LARGE_SPIRAM
+    if (size > bsp_lv_mem_class_size[BSP_LV_MEM_CLASSES - 1]) {
+        return heap_caps_malloc_prefer(sizeof(bsp_lv_mem_hdr_t) + size, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+                                       MALLOC_CAP_DEFAULT);
+    }
+#endif
+    return malloc(sizeof(bsp_lv_mem_hdr_t) + size);
+}
+
+esp_err_t bsp_lv_mem_get_class_stats(bsp_lv_mem_class_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_lv_mem.lock);
+    for (int i = 0; i < BSP_LV_MEM_CLASSES; i++) {
+        stats[i] = s_lv_mem.cls[i].stats;
+        stats[i].size = bsp_lv_mem_class_size[i];
+    }
+    portEXIT_CRITICAL(&s_lv_mem.lock);
+    return ESP_OK;
+}
+#else
+static bsp_lv_mem_hdr_t *bsp_lv_mem_heap_alloc(size_t size)
+{
+    return malloc(sizeof(bsp_lv_mem_hdr_t) + size);
+}
+#endif // CONFIG_BSP_LV_MEM_POOL
+
+void *bsp_lv_malloc(size_t size)
+{
+    bsp_lv_mem_hdr_t *hdr = NULL;
+    uint16_t cls = LV_MEM_CLASS_HEAP;
+
+#if CONFIG_BSP_LV_MEM_POOL
+    if (!s_lv_mem.ready) {
+        bsp_lv_mem_init();
+    }
+    const int c = bsp_lv_mem_class(size);
+    if (c >= 0) {
+        hdr = bsp_lv_mem_pop(c);
+#if !CONFIG_BSP_LV_MEM_POOL_STATIC
+        if (hdr == NULL && bsp_lv_mem_grow(c, MAX(CONFIG_BSP_LV_MEM_POOL_SLAB_SIZE / bsp_lv_mem_stride(c), 1))) {
+            hdr = bsp_lv_mem_pop(c);
+        }
+#endif
+        if (hdr) {
+            cls = c;
+        } else {
+            portENTER_CRITICAL(&s_lv_mem.lock);
+            s_lv_mem.cls[c].stats.overflow++;
+            portEXIT_CRITICAL(&s_lv_mem.lock);
+        }
+    }
+#endif
+    if (hdr == NULL) {
+        hdr = bsp_lv_mem_heap_alloc(size);
+    }
+
+    portENTER_CRITICAL(&s_lv_mem.lock);
+    if (hdr == NULL) {
+        s_lv_mem.failures++;
+        portEXIT_CRITICAL(&s_lv_mem.lock);
+        return NULL;
+    }
+    hdr->size = size;
+    hdr->cls = cls;
+    s_lv_mem.blocks++;
+    s_lv_mem.allocs++;
+    bsp_lv_mem_used_add(size);
+    portEXIT_CRITICAL(&s_lv_mem.lock);
+    return hdr + 1;
+}
+
+void bsp_lv_free(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    bsp_lv_mem_hdr_t *hdr = (bsp_lv_mem_hdr_t *)ptr - 1;
+    portENTER_CRITICAL(&s_lv_mem.lock);
+    s_lv_mem.blocks--;
+    s_lv_mem.used -= hdr->size;
+#if CONFIG_BSP_LV_MEM_POOL
+    if (hdr->cls != LV_MEM_CLASS_HEAP) {
+        bsp_lv_mem_push(hdr);
+        portEXIT_CRITICAL(&s_lv_mem.lock);
+        return;
+    }
+#endif
+    portEXIT_CRITICAL(&s_lv_mem.lock);
+    free(hdr);
+}
+
+void *bsp_lv_realloc(void *ptr, size_t size)
+{
+    if (ptr == NULL) {
+        return bsp_lv_malloc(size);
+    }
+    if (size == 0) {
+        bsp_lv_free(ptr);
+        return NULL;
+    }
+
+    bsp_lv_mem_hdr_t *hdr = (bsp_lv_mem_hdr_t *)ptr - 1;
+    const size_t old_size = hdr->size;
+#if CONFIG_BSP_LV_MEM_POOL
+    /* Pool blocks stay where they are while the size fits the class, otherwise the data moves */
+    if (hdr->cls != LV_MEM_CLASS_HEAP && size <= bsp_lv_mem_class_size[hdr->cls]) {
+        portENTER_CRITICAL(&s_lv_mem.lock);
+        hdr->size = size;
+        s_lv_mem.used -= old_size;
+        bsp_lv_mem_used_add(size);
+        portEXIT_CRITICAL(&s_lv_mem.lock);
+        return ptr;
+    }
+
+    void *new_ptr = bsp_lv_malloc(size);
+    if (new_ptr) {
+        memcpy(new_ptr, ptr, MIN(old_size, size));
+        bsp_lv_free(ptr);
+    }
+    return new_ptr;
+#else
+    hdr = realloc(hdr, sizeof(bsp_lv_mem_hdr_t) + size);
+    portENTER_CRITICAL(&s_lv_mem.lock);
+    if (hdr == NULL) {
+        /* The old block is still valid */
+        s_lv_mem.failures++;
+        portEXIT_CRITICAL(&s_lv_mem.lock);
+        return NULL;
+    }
+    hdr->size = size;
+    s_lv_mem.used -= old_size;
+    bsp_lv_mem_used_add(size);
+    portEXIT_CRITICAL(&s_lv_mem.lock);
+    return hdr + 1;
+#endif
+}
+
+#if CONFIG_BSP_HEAP_TELEMETRY_LVGL
+void bsp_lv_mem_get_stats(bsp_heap_lvgl_stats_t *stats)
+{
+    portENTER_CRITICAL(&s_lv_mem.lock);
+    stats->blocks = s_lv_mem.blocks;
+    stats->allocs = s_lv_mem.allocs;
+    stats->failures = s_lv_mem.failures;
+    stats->used = s_lv_mem.used;
+    stats->peak = s_lv_mem.peak;
+    portEXIT_CRITICAL(&s_lv_mem.lock);
+}
+#endif
+#endif // CONFIG_BSP_LV_MEM
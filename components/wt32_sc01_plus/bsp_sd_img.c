@@ -0,0 +1,705 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_SD_IMG
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_sd_img.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_sd_img";
+
+#define SD_IMG_TASK_STACK       (4096)
+#define SD_IMG_PATH_PREFIX      BSP_MOUNT_POINT "/"
+#define SD_IMG_CACHE_BYTES      (CONFIG_BSP_SD_IMG_CACHE_SIZE_KB * 1024)
+#define SD_IMG_CHUNK_BYTES      (CONFIG_BSP_SD_IMG_CHUNK_KB * 1024)
+#define SD_IMG_MAX_SIZE         (2047)      // lv_img_header_t width and height
+
+#if CONFIG_SPIRAM
+#define SD_IMG_CACHE_CAPS       (MALLOC_CAP_SPIRAM)
+#else
+#define SD_IMG_CACHE_CAPS       (MALLOC_CAP_DEFAULT)
+#endif
+
+#if LV_COLOR_16_SWAP
+#define SD_IMG_FLAGS_EXPECTED   (BSP_SD_IMG_FLAG_SWAP)
+#else
+#define SD_IMG_FLAGS_EXPECTED   (0)
+#endif
+
+/* Image tracked by the cache, its header stays known after the pixels were dropped */
+typedef struct {
+    char path[BSP_SD_IMG_PATH_MAX];     // Empty when the slot is free
+    bsp_img_file_header_t file;
+    uint8_t *pixels;                    // Decoded image, NULL while not loaded
+    uint32_t size;
+    uint32_t refs;                      // Open decoder descriptors drawing from pixels
+    uint32_t last_use;                  // s_sd.clock at the last open or load
+} bsp_sd_img_entry_t;
+
+#if CONFIG_BSP_IMG_RLE
+/* Decoder of a BSP_IMG_CF_RLE stream fed in chunks, packets may be split anywhere */
+typedef struct {
+    uint8_t *dst;
+    uint8_t *end;
+    uint32_t skip;                      // Header and line table bytes still to skip
+    uint32_t literal;                   // Bytes left in the current literal packet
+    uint32_t repeat;                    // Copies of the pixel being read, 0 outside repeat packets
+    uint8_t px[LV_IMG_PX_SIZE_ALPHA_BYTE];
+    uint8_t px_fill;
+    uint8_t px_size;
+} bsp_sd_img_rle_t;
+#endif
+
+/* Image larger than the cache, LVGL reads it line by line from the file */
+typedef struct {
+    FILE *f;
+    bsp_img_file_header_t file;
+#if CONFIG_BSP_IMG_RLE
+    uint32_t *offsets;                  // Offset of every line from the start of the data, NULL for raw images
+    uint8_t *packed;                    // Encoded line
+    uint8_t *line;                      // Decoded line
+    uint32_t packed_max;
+    lv_coord_t line_y;                  // Line held in line, -1 for none
+#endif
+} bsp_sd_img_stream_t;
+
+static struct {
+    lv_img_decoder_t *decoder;
+    SemaphoreHandle_t lock;             // Protects the entries, the counters and reserved
+    SemaphoreHandle_t load_lock;        // One load reads the card at a time
+    QueueHandle_t prefetch;             // Paths to load in the background
+    TaskHandle_t task;
+    uint8_t *chunk;                     // Read buffer of compressed images, used under load_lock
+    uint32_t clock;
+    uint32_t reserved;                  // Cache bytes of the load in progress
+    bsp_sd_img_entry_t entries[CONFIG_BSP_SD_IMG_CACHE_ENTRIES];
+    bsp_sd_img_stats_t stats;
+} s_sd;
+
+static bool bsp_sd_img_is_path(const char *path)
+{
+    return strncmp(path, SD_IMG_PATH_PREFIX, strlen(SD_IMG_PATH_PREFIX)) == 0 && strlen(path) < BSP_SD_IMG_PATH_MAX;
+}
+
+static inline size_t bsp_sd_img_px_size(const bsp_img_file_header_t *file)
+{
+    return (file->flags & BSP_SD_IMG_FLAG_ALPHA) ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+}
+
+static esp_err_t bsp_sd_img_check(const bsp_img_file_header_t *file)
+{
+    if (file->magic != BSP_SD_IMG_MAGIC || (file->flags & BSP_SD_IMG_FLAG_SWAP) != SD_IMG_FLAGS_EXPECTED ||
+            file->width == 0 || file->width > SD_IMG_MAX_SIZE || file->height == 0 || file->height > SD_IMG_MAX_SIZE) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    const uint32_t decoded = file->width * file->height * bsp_sd_img_px_size(file);
+    switch (file->type) {
+    case BSP_ASSET_IMG_RGB565:
+    case BSP_ASSET_IMG_RGB565A8:
+        return (file->size == decoded && bsp_sd_img_px_size(file) == (file->type == BSP_ASSET_IMG_RGB565A8 ?
+                LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t))) ? ESP_OK : ESP_ERR_INVALID_SIZE;
+#if CONFIG_BSP_IMG_RLE
+    case BSP_ASSET_IMG_RLE:
+        return (file->size >= sizeof(bsp_img_rle_header_t) + file->height * sizeof(uint32_t)) ? ESP_OK : ESP_ERR_INVALID_SIZE;
+#endif
+    default:
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+}
+
+/* Functions below up to the decoder callbacks are called with s_sd.lock held */
+static bsp_sd_img_entry_t *bsp_sd_img_find(const char *path)
+{
+    for (size_t i = 0; i < CONFIG_BSP_SD_IMG_CACHE_ENTRIES; i++) {
+        if (strcmp(s_sd.entries[i].path, path) == 0) {
+            return &s_sd.entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void bsp_sd_img_evict(bsp_sd_img_entry_t *entry)
+{
+    heap_caps_free(entry->pixels);
+    s_sd.stats.cache_bytes -= entry->size;
+    s_sd.stats.evictions++;
+    entry->pixels = NULL;
+    entry->size = 0;
+}
+
+/* Least recently used entry LVGL does not draw from */
+static bsp_sd_img_entry_t *bsp_sd_img_lru(bool with_pixels)
+{
+    bsp_sd_img_entry_t *lru = NULL;
+    for (size_t i = 0; i < CONFIG_BSP_SD_IMG_CACHE_ENTRIES; i++) {
+        bsp_sd_img_entry_t *entry = &s_sd.entries[i];
+        if (entry->path[0] == '\0' || entry->refs > 0 || (entry->pixels != NULL) != with_pixels) {
+            continue;
+        }
+        if (lru == NULL || s_sd.clock - entry->last_use > s_sd.clock - lru->last_use) {
+            lru = entry;
+        }
+    }
+    return lru;
+}
+
+/*
+ * Find the entry of path or start tracking it: in a free slot, else in place of the least recently used one.
+ * Only a load, which brings pixels of its own, may take the slot of cached pixels, a header never evicts them.
+ */
+static bsp_sd_img_entry_t *bsp_sd_img_track(const char *path, const bsp_img_file_header_t *file, bool evict)
+{
+    bsp_sd_img_entry_t *entry = bsp_sd_img_find(path);
+    if (entry) {
+        return entry;
+    }
+    for (size_t i = 0; i < CONFIG_BSP_SD_IMG_CACHE_ENTRIES && entry == NULL; i++) {
+        if (s_sd.entries[i].path[0] == '\0') {
+            entry = &s_sd.entries[i];
+        }
+    }
+    if (entry == NULL && (entry = bsp_sd_img_lru(false)) == NULL &&
+            (!evict || (entry = bsp_sd_img_lru(true)) == NULL)) {
+        return NULL;    // LVGL has every tracked image open, or only cached images are left
+    }
+    if (entry->pixels) {
+        bsp_sd_img_evict(entry);
+    }
+    memset(entry, 0, sizeof(*entry));
+    strlcpy(entry->path, path, sizeof(entry->path));
+    entry->file = *file;
+    entry->last_use = ++s_sd.clock;
+    return entry;
+}
+
+/* Make room for size bytes, the least recently used images go first */
+static bool bsp_sd_img_reserve(uint32_t size)
+{
+    if (size > SD_IMG_CACHE_BYTES) {
+        return false;
+    }
+    while (s_sd.stats.cache_bytes + s_sd.reserved + size > SD_IMG_CACHE_BYTES) {
+        bsp_sd_img_entry_t *lru = bsp_sd_img_lru(true);
+        if (lru == NULL) {
+            return false;
+        }
+        bsp_sd_img_evict(lru);
+    }
+    s_sd.reserved += size;
+    return true;
+}
+
+/* Hand the cached pixels of path to LVGL, dsc may be NULL to only check they are there */
+static bool bsp_sd_img_acquire(const char *path, lv_img_decoder_dsc_t *dsc)
+{
+    bsp_sd_img_entry_t *entry = bsp_sd_img_find(path);
+    if (entry == NULL || entry->pixels == NULL) {
+        return false;
+    }
+    entry->last_use = ++s_sd.clock;
+    if (dsc) {
+        entry->refs++;
+        dsc->img_data = entry->pixels;
+        dsc->user_data = entry;
+    }
+    return true;
+}
+
+#if CONFIG_BSP_IMG_RLE
+static void bsp_sd_img_rle_feed(bsp_sd_img_rle_t *rle, const uint8_t *src, size_t len)
+{
+    const uint8_t *end = src + len;
+    while (src < end && rle->dst < rle->end) {
+        size_t n;
+        if (rle->skip) {
+            n = LV_MIN(rle->skip, end - src);
+            rle->skip -= n;
+            src += n;
+        } else if (rle->literal) {
+            n = LV_MIN(LV_MIN(rle->literal, end - src), rle->end - rle->dst);
+            memcpy(rle->dst, src, n);
+            rle->literal -= n;
+            rle->dst += n;
+            src += n;
+        } else if (rle->repeat) {
+            n = LV_MIN(rle->px_size - rle->px_fill, end - src);
+            memcpy(&rle->px[rle->px_fill], src, n);
+            rle->px_fill += n;
+            src += n;
+            if (rle->px_fill == rle->px_size) {
+                for (; rle->repeat && rle->dst + rle->px_size <= rle->end; rle->repeat--) {
+                    memcpy(rle->dst, rle->px, rle->px_size);
+                    rle->dst += rle->px_size;
+                }
+                rle->repeat = 0;
+            }
+        } else {
+            const uint8_t ctrl = *src++;
+            const uint32_t count = (ctrl & 0x7F) + 1;
+            if (ctrl & 0x80) {
+                rle->repeat = count;
+                rle->px_fill = 0;
+            } else {
+                rle->literal = count * rle->px_size;
+            }
+        }
+    }
+}
+#endif
+
+/* Read the data of an image file in chunks and decode it into pixels */
+static esp_err_t bsp_sd_img_read(FILE *f, const bsp_img_file_header_t *file, uint8_t *pixels, uint32_t size)
+{
+#if CONFIG_BSP_IMG_RLE
+    if (file->type == BSP_ASSET_IMG_RLE) {
+        bsp_sd_img_rle_t rle = {
+            .dst = pixels,
+            .end = pixels + size,
+            .skip = sizeof(bsp_img_rle_header_t) + file->height * sizeof(uint32_t),
+            .px_size = bsp_sd_img_px_size(file),
+        };
+        for (uint32_t left = file->size; left > 0;) {
+            const size_t n = fread(s_sd.chunk, 1, LV_MIN(left, SD_IMG_CHUNK_BYTES), f);
+            if (n == 0) {
+                return ESP_FAIL;
+            }
+            bsp_sd_img_rle_feed(&rle, s_sd.chunk, n);
+            left -= n;
+        }
+        return (rle.dst == rle.end) ? ESP_OK : ESP_ERR_INVALID_SIZE;
+    }
+#endif
+    /* Raw pixels go straight into the cache, the chunks only bound the size of one read */
+    for (uint32_t offset = 0; offset < size;) {
+        const size_t n = fread(pixels + offset, 1, LV_MIN(size - offset, SD_IMG_CHUNK_BYTES), f);
+        if (n == 0) {
+            return ESP_FAIL;
+        }
+        offset += n;
+    }
+    return ESP_OK;
+}
+
+/*
+ * Load path into the cache unless it is there already, and hand it to LVGL when dsc is given.
+ * Returns ESP_ERR_TIMEOUT when another load holds the card for longer than wait.
+ */
+static esp_err_t bsp_sd_img_load(const char *path, lv_img_decoder_dsc_t *dsc, TickType_t wait)
+{
+    if (xSemaphoreTake(s_sd.load_lock, wait) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    const bool cached = bsp_sd_img_acquire(path, dsc);     // Loaded by a prefetch meanwhile
+    xSemaphoreGive(s_sd.lock);
+    if (cached) {
+        xSemaphoreGive(s_sd.load_lock);
+        return ESP_OK;
+    }
+
+    const int64_t start = esp_timer_get_time();
+    bsp_img_file_header_t file = { 0 };
+    uint8_t *pixels = NULL;
+    uint32_t size = 0;
+    bool reserved = false;
+    esp_err_t ret = ESP_OK;
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        ret = ESP_ERR_NOT_FOUND;
+        goto out;
+    }
+    /* Chunks go straight to FATFS, without a copy through the stdio buffer */
+    setvbuf(f, NULL, _IONBF, 0);
+    if (fread(&file, sizeof(file), 1, f) != 1) {
+        ret = ESP_FAIL;
+        goto out;
+    }
+    ret = bsp_sd_img_check(&file);
+    if (ret != ESP_OK) {
+        goto out;
+    }
+
+    size = file.width * file.height * bsp_sd_img_px_size(&file);
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    /* Known from now on, bsp_sd_img_info() does not read the card for an image being prefetched */
+    bsp_sd_img_track(path, &file, false);
+    reserved = bsp_sd_img_reserve(size);
+    xSemaphoreGive(s_sd.lock);
+    pixels = reserved ? heap_caps_malloc(size, SD_IMG_CACHE_CAPS) : NULL;
+    if (pixels == NULL) {
+        ret = ESP_ERR_NO_MEM;
+        goto out;
+    }
+    ret = bsp_sd_img_read(f, &file, pixels, size);
+
+out:
+    if (f) {
+        fclose(f);
+    }
+    const uint32_t load_us = esp_timer_get_time() - start;
+
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    if (reserved) {
+        s_sd.reserved -= size;
+    }
+    bsp_sd_img_entry_t *entry = (ret == ESP_OK) ? bsp_sd_img_track(path, &file, true) : NULL;
+    if (entry) {
+        entry->file = file;
+        entry->pixels = pixels;
+        entry->size = size;
+        pixels = NULL;
+        s_sd.stats.cache_bytes += size;
+        s_sd.stats.loads++;
+        s_sd.stats.load_us += load_us;
+        s_sd.stats.load_us_max = LV_MAX(s_sd.stats.load_us_max, load_us);
+        s_sd.stats.load_bytes += sizeof(file) + file.size;
+        if (dsc == NULL) {
+            s_sd.stats.prefetches++;
+        }
+        bsp_sd_img_acquire(path, dsc);
+    } else {
+        ret = (ret == ESP_OK) ? ESP_ERR_NO_MEM : ret;
+        s_sd.stats.load_errors++;
+    }
+    xSemaphoreGive(s_sd.lock);
+    xSemaphoreGive(s_sd.load_lock);
+
+    heap_caps_free(pixels);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Loading %s failed (%s)", path, esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+static void bsp_sd_img_stream_free(bsp_sd_img_stream_t *stream)
+{
+    if (stream->f) {
+        fclose(stream->f);
+    }
+#if CONFIG_BSP_IMG_RLE
+    heap_caps_free(stream->offsets);
+    heap_caps_free(stream->packed);
+    heap_caps_free(stream->line);
+#endif
+    heap_caps_free(stream);
+}
+
+/* Open path for read_line, for images the cache cannot hold */
+static esp_err_t bsp_sd_img_stream_open(const char *path, lv_img_decoder_dsc_t *dsc)
+{
+    bsp_sd_img_stream_t *stream = heap_caps_calloc(1, sizeof(*stream), MALLOC_CAP_DEFAULT);
+    if (stream == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = ESP_FAIL;
+    stream->f = fopen(path, "rb");
+    if (stream->f == NULL || fread(&stream->file, sizeof(stream->file), 1, stream->f) != 1) {
+        goto err;
+    }
+    ret = bsp_sd_img_check(&stream->file);
+    if (ret != ESP_OK) {
+        goto err;
+    }
+#if CONFIG_BSP_IMG_RLE
+    if (stream->file.type == BSP_ASSET_IMG_RLE) {
+        const size_t px_size = bsp_sd_img_px_size(&stream->file);
+        /* A line never takes more than one control byte per pixel on top of its pixels */
+        stream->packed_max = stream->file.width * (px_size + 1);
+        stream->offsets = heap_caps_malloc(stream->file.height * sizeof(uint32_t), MALLOC_CAP_DEFAULT);
+        stream->packed = heap_caps_malloc(stream->packed_max, MALLOC_CAP_DEFAULT);
+        stream->line = heap_caps_malloc(stream->file.width * px_size, MALLOC_CAP_DEFAULT);
+        stream->line_y = -1;
+        ret = ESP_ERR_NO_MEM;
+        if (stream->offsets == NULL || stream->packed == NULL || stream->line == NULL) {
+            goto err;
+        }
+        ret = ESP_FAIL;
+        if (fseek(stream->f, sizeof(stream->file) + sizeof(bsp_img_rle_header_t), SEEK_SET) != 0 ||
+                fread(stream->offsets, sizeof(uint32_t), stream->file.height, stream->f) != stream->file.height) {
+            goto err;
+        }
+    }
+#endif
+
+    dsc->img_data = NULL;
+    dsc->user_data = stream;
+    return ESP_OK;
+
+err:
+    bsp_sd_img_stream_free(stream);
+    return ret;
+}
+
+static lv_res_t bsp_sd_img_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc, lv_coord_t x,
+                                     lv_coord_t y, lv_coord_t len, uint8_t *buf)
+{
+    bsp_sd_img_stream_t *stream = dsc->user_data;
+    const bsp_img_file_header_t *file = &stream->file;
+    const size_t px_size = bsp_sd_img_px_size(file);
+    if (x < 0 || y < 0 || len <= 0 || x + len > file->width || y >= file->height) {
+        return LV_RES_INV;
+    }
+
+#if CONFIG_BSP_IMG_RLE
+    if (stream->offsets) {
+        if (stream->line_y != y) {
+            /* Lines are decoded whole, LVGL usually asks for the rest of the same line next */
+            const uint32_t start = stream->offsets[y];
+            const uint32_t end = (y + 1 < file->height) ? stream->offsets[y + 1] : file->size;
+            if (end < start || end > file->size || end - start > stream->packed_max) {
+                return LV_RES_INV;
+            }
+            if (fseek(stream->f, sizeof(*file) + start, SEEK_SET) != 0 ||
+                    fread(stream->packed, 1, end - start, stream->f) != end - start) {
+                return LV_RES_INV;
+            }
+            bsp_sd_img_rle_t rle = {
+                .dst = stream->line,
+                .end = stream->line + file->width * px_size,
+                .px_size = px_size,
+            };
+            bsp_sd_img_rle_feed(&rle, stream->packed, end - start);
+            if (rle.dst != rle.end) {
+                stream->line_y = -1;
+                return LV_RES_INV;
+            }
+            stream->line_y = y;
+        }
+        memcpy(buf, stream->line + x * px_size, len * px_size);
+        return LV_RES_OK;
+    }
+#endif
+    const long pos = sizeof(*file) + ((long)y * file->width + x) * px_size;
+    if (fseek(stream->f, pos, SEEK_SET) != 0 || fread(buf, px_size, len, stream->f) != (size_t)len) {
+        return LV_RES_INV;
+    }
+    return LV_RES_OK;
+}
+
+static lv_res_t bsp_sd_img_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE || !bsp_sd_img_is_path(src)) {
+        return LV_RES_INV;
+    }
+
+    bsp_img_file_header_t file;
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    const bsp_sd_img_entry_t *entry = bsp_sd_img_find(src);
+    if (entry) {
+        file = entry->file;
+    }
+    xSemaphoreGive(s_sd.lock);
+
+    if (entry == NULL) {
+        /* Only the header is read, in the LVGL task, and remembered for the next layout. A prefetch in
+         * progress delays it by one chunk at most, FATFS serializes the reads but not whole loads */
+        FILE *f = fopen(src, "rb");
+        if (f == NULL) {
+            return LV_RES_INV;
+        }
+        const bool read = fread(&file, sizeof(file), 1, f) == 1;
+        fclose(f);
+        if (!read || bsp_sd_img_check(&file) != ESP_OK) {
+            ESP_LOGW(TAG, "%s is not a valid image file", (const char *)src);
+            return LV_RES_INV;
+        }
+        xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+        bsp_sd_img_track(src, &file, false);
+        xSemaphoreGive(s_sd.lock);
+    }
+
+    header->always_zero = 0;
+    header->w = file.width;
+    header->h = file.height;
+    header->cf = (file.flags & BSP_SD_IMG_FLAG_ALPHA) ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+static lv_res_t bsp_sd_img_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    const bool hit = bsp_sd_img_acquire(dsc->src, dsc);
+    if (hit) {
+        s_sd.stats.hits++;
+    } else {
+        s_sd.stats.misses++;
+    }
+    xSemaphoreGive(s_sd.lock);
+
+    if (hit) {
+        return LV_RES_OK;
+    }
+    /* LVGL does not wait for a prefetch, which holds the card for a whole image */
+    const esp_err_t ret = bsp_sd_img_load(dsc->src, dsc, 0);
+    if ((ret == ESP_ERR_NO_MEM || ret == ESP_ERR_TIMEOUT) && bsp_sd_img_stream_open(dsc->src, dsc) == ESP_OK) {
+        /* Shown anyway, LVGL reads the lines from the card each time they are drawn */
+        xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+        s_sd.stats.streams++;
+        xSemaphoreGive(s_sd.lock);
+        return LV_RES_OK;
+    }
+    return (ret == ESP_OK) ? LV_RES_OK : LV_RES_INV;
+}
+
+static void bsp_sd_img_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    if (dsc->img_data == NULL && dsc->user_data) {
+        bsp_sd_img_stream_free(dsc->user_data);
+        dsc->user_data = NULL;
+        return;
+    }
+    bsp_sd_img_entry_t *entry = dsc->user_data;
+    if (entry) {
+        xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+        entry->refs--;
+        xSemaphoreGive(s_sd.lock);
+        dsc->user_data = NULL;
+    }
+    dsc->img_data = NULL;
+}
+
+static void bsp_sd_img_task(void *arg)
+{
+    char path[BSP_SD_IMG_PATH_MAX];
+    while (true) {
+        xQueueReceive(s_sd.prefetch, path, portMAX_DELAY);
+        bsp_sd_img_load(path, NULL, portMAX_DELAY);
+    }
+}
+
+esp_err_t bsp_sd_img_prefetch(const char *path)
+{
+    BSP_NULL_CHECK(path, ESP_ERR_INVALID_ARG);
+    if (!bsp_sd_img_is_path(path)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_sd.prefetch == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    const bool cached = bsp_sd_img_acquire(path, NULL);
+    xSemaphoreGive(s_sd.lock);
+    if (cached) {
+        return ESP_OK;
+    }
+
+    char item[BSP_SD_IMG_PATH_MAX];
+    strlcpy(item, path, sizeof(item));
+    return (xQueueSend(s_sd.prefetch, item, 0) == pdTRUE) ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+esp_err_t bsp_sd_img_get_stats(bsp_sd_img_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+    if (s_sd.lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    *stats = s_sd.stats;
+    xSemaphoreGive(s_sd.lock);
+    return ESP_OK;
+}
+
+void bsp_sd_img_reset_stats(void)
+{
+    if (s_sd.lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    const uint32_t cache_bytes = s_sd.stats.cache_bytes;
+    memset(&s_sd.stats, 0, sizeof(s_sd.stats));
+    s_sd.stats.cache_bytes = cache_bytes;
+    xSemaphoreGive(s_sd.lock);
+}
+
+void bsp_sd_img_cache_drop(void)
+{
+    if (s_sd.lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_sd.lock, portMAX_DELAY);
+    for (size_t i = 0; i < CONFIG_BSP_SD_IMG_CACHE_ENTRIES; i++) {
+        bsp_sd_img_entry_t *entry = &s_sd.entries[i];
+        if (entry->refs == 0) {
+            if (entry->pixels) {
+                bsp_sd_img_evict(entry);
+            }
+            memset(entry, 0, sizeof(*entry));
+        }
+    }
+    xSemaphoreGive(s_sd.lock);
+}
+
+esp_err_t bsp_sd_img_init(void)
+{
+    if (s_sd.decoder) {
+        return ESP_OK;
+    }
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    s_sd.lock = xSemaphoreCreateMutex();
+    s_sd.load_lock = xSemaphoreCreateMutex();
+    s_sd.prefetch = xQueueCreate(CONFIG_BSP_SD_IMG_PREFETCH_QUEUE_LEN, BSP_SD_IMG_PATH_MAX);
+#if CONFIG_BSP_IMG_RLE
+    s_sd.chunk = heap_caps_malloc(SD_IMG_CHUNK_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    BSP_NULL_CHECK_GOTO(s_sd.chunk, err);
+#endif
+    BSP_NULL_CHECK_GOTO(s_sd.lock, err);
+    BSP_NULL_CHECK_GOTO(s_sd.load_lock, err);
+    BSP_NULL_CHECK_GOTO(s_sd.prefetch, err);
+
+    bsp_display_lock(0);
+    s_sd.decoder = lv_img_decoder_create();
+    if (s_sd.decoder) {
+        lv_img_decoder_set_info_cb(s_sd.decoder, bsp_sd_img_info);
+        lv_img_decoder_set_open_cb(s_sd.decoder, bsp_sd_img_open);
+        lv_img_decoder_set_read_line_cb(s_sd.decoder, bsp_sd_img_read_line);
+        lv_img_decoder_set_close_cb(s_sd.decoder, bsp_sd_img_close);
+    }
+    bsp_display_unlock();
+    BSP_NULL_CHECK_GOTO(s_sd.decoder, err);
+
+    if (xTaskCreate(bsp_sd_img_task, "sd_img", SD_IMG_TASK_STACK, NULL, CONFIG_BSP_SD_IMG_TASK_PRIORITY,
+                    &s_sd.task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create prefetch task");
+        bsp_display_lock(0);
+        lv_img_decoder_delete(s_sd.decoder);
+        bsp_display_unlock();
+        s_sd.decoder = NULL;
+        goto err;
+    }
+
+    ESP_LOGI(TAG, "Images under %s are cached in %d kB of %s", BSP_MOUNT_POINT, CONFIG_BSP_SD_IMG_CACHE_SIZE_KB,
+             (SD_IMG_CACHE_CAPS == MALLOC_CAP_SPIRAM) ? "PSRAM" : "RAM");
+    return ESP_OK;
+
+err:
+    heap_caps_free(s_sd.chunk);
+    if (s_sd.prefetch) {
+        vQueueDelete(s_sd.prefetch);
+    }
+    if (s_sd.load_lock) {
+        vSemaphoreDelete(s_sd.load_lock);
+    }
+    if (s_sd.lock) {
+        vSemaphoreDelete(s_sd.lock);
+    }
+    memset(&s_sd, 0, sizeof(s_sd));
+    return ret;
+}
+#endif // CONFIG_BSP_SD_IMG
@@ -0,0 +1,540 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_SD_IO
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/ringbuf.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_sd_io";
+
+#define SD_IO_TASK_STACK        (4096)
+#define SD_IO_BUFFER_BYTES      (CONFIG_BSP_SD_IO_BUFFER_KB * 1024)
+#define SD_IO_CHUNK_BYTES       (CONFIG_BSP_SD_IO_CHUNK_KB * 1024)
+#define SD_IO_FILE_CALLBACKS    (32)    // Completions one file holds back until its chunk is written
+
+#if CONFIG_SPIRAM
+#define SD_IO_BUFFER_CAPS       (MALLOC_CAP_SPIRAM)
+#else
+#define SD_IO_BUFFER_CAPS       (MALLOC_CAP_DEFAULT)
+#endif
+
+typedef enum {
+    SD_IO_OP_WRITE,
+    SD_IO_OP_READ,
+    SD_IO_OP_TRUNCATE,
+    SD_IO_OP_FLUSH,
+} sd_io_op_t;
+
+/* Item of the request buffer, write data follows the header */
+typedef struct {
+    sd_io_op_t op;
+    uint32_t size;                      // Write data size, or size of buf for reads
+    uint32_t offset;                    // Reads only
+    void *buf;                          // Reads only
+    bsp_sd_io_cb_t cb;
+    void *user_ctx;
+    int64_t queued_us;
+    char path[BSP_SD_IO_PATH_MAX];
+    uint8_t data[];
+} sd_io_req_t;
+
+typedef struct {
+    bsp_sd_io_cb_t cb;
+    void *user_ctx;
+    uint32_t size;
+    int64_t queued_us;
+} sd_io_done_t;
+
+/* File kept open by the I/O task, with the appends not written yet */
+typedef struct {
+    char path[BSP_SD_IO_PATH_MAX];      // Empty when the slot is free
+    FILE *f;
+    uint8_t *chunk;                     // Staged appends, DMA capable
+    uint32_t fill;
+    uint32_t limit;                     // Staged size that ends at a chunk aligned file offset
+    uint32_t pos;                       // File size without the staged data
+    uint32_t last_use;
+    bool dirty;                         // Written since the last sync
+    uint32_t done_count;
+    sd_io_done_t done[SD_IO_FILE_CALLBACKS];
+} sd_io_file_t;
+
+static struct {
+    RingbufHandle_t ring;
+    StaticRingbuffer_t ring_struct;
+    uint8_t *ring_storage;
+    uint8_t *chunks;
+    TaskHandle_t task;
+    portMUX_TYPE lock;                  // Protects stats, taken by callers, never held across I/O
+    bsp_sd_io_stats_t stats;
+    uint32_t clock;                     // Used by the I/O task only, like the files
+    sd_io_file_t files[CONFIG_BSP_SD_IO_OPEN_FILES];
+} s_io = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static void sd_io_count_error(void)
+{
+    portENTER_CRITICAL(&s_io.lock);
+    s_io.stats.errors++;
+    portEXIT_CRITICAL(&s_io.lock);
+}
+
+static void sd_io_complete(bsp_sd_io_cb_t cb, void *user_ctx, esp_err_t ret, size_t size, int64_t queued_us)
+{
+    if (cb == NULL) {
+        return;
+    }
+    const uint32_t latency_us = esp_timer_get_time() - queued_us;
+    portENTER_CRITICAL(&s_io.lock);
+    s_io.stats.completions++;
+    s_io.stats.latency_us_total += latency_us;
+    s_io.stats.latency_us_max = LV_MAX(s_io.stats.latency_us_max, latency_us);
+    portEXIT_CRITICAL(&s_io.lock);
+    cb(ret, size, user_ctx);
+}
+
+/* Time a FATFS call, callers never see this stall but the I/O task does */
+static void sd_io_count_fs(int64_t start_us, size_t written)
+{
+    const uint32_t elapsed_us = esp_timer_get_time() - start_us;
+    portENTER_CRITICAL(&s_io.lock);
+    s_io.stats.fs_us_max = LV_MAX(s_io.stats.fs_us_max, elapsed_us);
+    if (written) {
+        s_io.stats.chunk_writes++;
+        s_io.stats.bytes_written += written;
+    } else {
+        s_io.stats.syncs++;
+    }
+    portEXIT_CRITICAL(&s_io.lock);
+}
+
+/* Write the staged data of file and complete the appends waiting for it */
+static esp_err_t sd_io_file_write(sd_io_file_t *file)
+{
+    esp_err_t ret = ESP_OK;
+    if (file->fill) {
+        const int64_t start = esp_timer_get_time();
+        const size_t written = fwrite(file->chunk, 1, file->fill, file->f);
+        sd_io_count_fs(start, written);
+        if (written != file->fill) {
+            ESP_LOGE(TAG, "Writing %" PRIu32 " B to %s failed", file->fill, file->path);
+            sd_io_count_error();
+            ret = ESP_FAIL;
+        }
+        /* The part that did not make it is dropped, its appends complete with the error */
+        file->pos += written;
+        file->fill = 0;
+        file->limit = SD_IO_CHUNK_BYTES - file->pos % SD_IO_CHUNK_BYTES;
+        file->dirty |= written > 0;
+    }
+
+    for (uint32_t i = 0; i < file->done_count; i++) {
+        const sd_io_done_t *done = &file->done[i];
+        sd_io_complete(done->cb, done->user_ctx, ret, done->size, done->queued_us);
+    }
+    file->done_count = 0;
+    return ret;
+}
+
+static esp_err_t sd_io_file_sync(sd_io_file_t *file)
+{
+    esp_err_t ret = sd_io_file_write(file);
+    if (file->dirty) {
+        const int64_t start = esp_timer_get_time();
+        if (fsync(fileno(file->f)) != 0) {
+            sd_io_count_error();
+            ret = ESP_FAIL;
+        }
+        sd_io_count_fs(start, 0);
+        file->dirty = false;
+    }
+    return ret;
+}
+
+static esp_err_t sd_io_file_close(sd_io_file_t *file)
+{
+    esp_err_t ret = sd_io_file_write(file);
+    if (fclose(file->f) != 0) {
+        sd_io_count_error();
+        ret = ESP_FAIL;
+    }
+    file->path[0] = '\0';
+    file->f = NULL;
+    file->dirty = false;
+    return ret;
+}
+
+static sd_io_file_t *sd_io_file_find(const char *path)
+{
+    for (size_t i = 0; i < CONFIG_BSP_SD_IO_OPEN_FILES; i++) {
+        if (strcmp(s_io.files[i].path, path) == 0) {
+            return &s_io.files[i];
+        }
+    }
+    return NULL;
+}
+
+/* Open file of path, the least recently used one is closed when all slots are taken */
+static sd_io_file_t *sd_io_file_get(const char *path)
+{
+    sd_io_file_t *file = sd_io_file_find(path);
+    if (file) {
+        file->last_use = ++s_io.clock;
+        return file;
+    }
+
+    for (size_t i = 0; i < CONFIG_BSP_SD_IO_OPEN_FILES; i++) {
+        sd_io_file_t *slot = &s_io.files[i];
+        if (slot->path[0] == '\0') {
+            file = slot;
+            break;
+        }
+        if (file == NULL || s_io.clock - slot->last_use > s_io.clock - file->last_use) {
+            file = slot;
+        }
+    }
+    if (file->path[0] != '\0') {
+        sd_io_file_close(file);
+    }
+
+    FILE *f = fopen(path, "ab");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Opening %s failed", path);
+        sd_io_count_error();
+        return NULL;
+    }
+    /* Chunks go straight to FATFS, the stdio buffer would only add a copy */
+    setvbuf(f, NULL, _IONBF, 0);
+    fseek(f, 0, SEEK_END);
+    const long pos = ftell(f);
+
+    strlcpy(file->path, path, sizeof(file->path));
+    file->f = f;
+    file->fill = 0;
+    file->pos = (pos > 0) ? pos : 0;
+    file->limit = SD_IO_CHUNK_BYTES - file->pos % SD_IO_CHUNK_BYTES;
+    file->last_use = ++s_io.clock;
+    file->dirty = false;
+    file->done_count = 0;
+    return file;
+}
+
+static void sd_io_do_write(const sd_io_req_t *req)
+{
+    sd_io_file_t *file = sd_io_file_get(req->path);
+    if (file == NULL) {
+        sd_io_complete(req->cb, req->user_ctx, ESP_ERR_NOT_FOUND, 0, req->queued_us);
+        return;
+    }
+
+    esp_err_t ret = ESP_OK;
+    const uint8_t *data = req->data;
+    for (uint32_t left = req->size; left > 0 && ret == ESP_OK;) {
+        const uint32_t n = LV_MIN(left, file->limit - file->fill);
+        memcpy(file->chunk + file->fill, data, n);
+        file->fill += n;
+        data += n;
+        left -= n;
+        if (file->fill == file->limit) {
+            ret = sd_io_file_write(file);
+        }
+    }
+
+    if (req->cb == NULL) {
+        return;
+    }
+    if (ret != ESP_OK || file->fill == 0) {
+        sd_io_complete(req->cb, req->user_ctx, ret, req->size, req->queued_us);
+        return;
+    }
+    if (file->done_count == SD_IO_FILE_CALLBACKS) {
+        /* Write early rather than hold back more completions */
+        ret = sd_io_file_write(file);
+        sd_io_complete(req->cb, req->user_ctx, ret, req->size, req->queued_us);
+        return;
+    }
+    file->done[file->done_count++] = (sd_io_done_t) {
+        .cb = req->cb,
+        .user_ctx = req->user_ctx,
+        .size = req->size,
+        .queued_us = req->queued_us,
+    };
+}
+
+static void sd_io_do_read(const sd_io_req_t *req)
+{
+    /* The open file is closed first, so the read sees its staged data and FATFS never has it open twice */
+    sd_io_file_t *file = sd_io_file_find(req->path);
+    if (file) {
+        sd_io_file_close(file);
+    }
+
+    size_t read = 0;
+    esp_err_t ret = ESP_OK;
+    FILE *f = fopen(req->path, "rb");
+    if (f == NULL) {
+        ret = ESP_ERR_NOT_FOUND;
+    } else {
+        setvbuf(f, NULL, _IONBF, 0);
+        if (fseek(f, req->offset, SEEK_SET) == 0) {
+            read = fread(req->buf, 1, req->size, f);
+        }
+        if (ferror(f)) {
+            sd_io_count_error();
+            ret = ESP_FAIL;
+        }
+        fclose(f);
+    }
+
+    portENTER_CRITICAL(&s_io.lock);
+    s_io.stats.bytes_read += read;
+    portEXIT_CRITICAL(&s_io.lock);
+    sd_io_complete(req->cb, req->user_ctx, ret, read, req->queued_us);
+}
+
+static void sd_io_do_truncate(const sd_io_req_t *req)
+{
+    /* Appends queued before are written first, the truncation drops them like any other content */
+    sd_io_file_t *file = sd_io_file_find(req->path);
+    esp_err_t ret = file ? sd_io_file_close(file) : ESP_OK;
+
+    FILE *f = fopen(req->path, "wb");
+    if (f == NULL || fclose(f) != 0) {
+        ESP_LOGE(TAG, "Truncating %s failed", req->path);
+        sd_io_count_error();
+        ret = ESP_FAIL;
+    }
+    sd_io_complete(req->cb, req->user_ctx, ret, 0, req->queued_us);
+}
+
+static void sd_io_do_flush(const sd_io_req_t *req)
+{
+    esp_err_t ret = ESP_OK;
+    for (size_t i = 0; i < CONFIG_BSP_SD_IO_OPEN_FILES; i++) {
+        if (s_io.files[i].path[0] != '\0') {
+            const esp_err_t file_ret = sd_io_file_close(&s_io.files[i]);
+            ret = (ret != ESP_OK) ? ret : file_ret;
+        }
+    }
+    sd_io_complete(req->cb, req->user_ctx, ret, 0, req->queued_us);
+}
+
+static bool sd_io_idle_work(void)
+{
+    for (size_t i = 0; i < CONFIG_BSP_SD_IO_OPEN_FILES; i++) {
+        const sd_io_file_t *file = &s_io.files[i];
+        if (file->path[0] != '\0' && (file->fill || file->dirty)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void sd_io_task(void *arg)
+{
+    int64_t synced_us = esp_timer_get_time();
+    while (true) {
+        /* Staged data is synced SYNC_MS after it was clean at the latest, however busy the queue is */
+        TickType_t timeout = portMAX_DELAY;
+        if (sd_io_idle_work()) {
+            const int64_t left_ms = CONFIG_BSP_SD_IO_SYNC_MS - (esp_timer_get_time() - synced_us) / 1000;
+            timeout = (left_ms > 0) ? pdMS_TO_TICKS(left_ms) : 0;
+            if (timeout == 0) {
+                for (size_t i = 0; i < CONFIG_BSP_SD_IO_OPEN_FILES; i++) {
+                    if (s_io.files[i].path[0] != '\0') {
+                        sd_io_file_sync(&s_io.files[i]);
+                    }
+                }
+                synced_us = esp_timer_get_time();
+                continue;
+            }
+        } else {
+            synced_us = esp_timer_get_time();
+        }
+
+        size_t item_size = 0;
+        sd_io_req_t *req = xRingbufferReceive(s_io.ring, &item_size, timeout);
+        if (req == NULL) {
+            continue;
+        }
+
+        switch (req->op) {
+        case SD_IO_OP_WRITE:
+            sd_io_do_write(req);
+            break;
+        case SD_IO_OP_READ:
+            sd_io_do_read(req);
+            break;
+        case SD_IO_OP_TRUNCATE:
+            sd_io_do_truncate(req);
+            break;
+        default:
+            sd_io_do_flush(req);
+            break;
+        }
+
+        const uint32_t queued_bytes = (req->op == SD_IO_OP_WRITE) ? req->size : 0;
+        vRingbufferReturnItem(s_io.ring, req);
+        portENTER_CRITICAL(&s_io.lock);
+        s_io.stats.queue_depth--;
+        s_io.stats.queued_bytes -= queued_bytes;
+        portEXIT_CRITICAL(&s_io.lock);
+    }
+}
+
+static esp_err_t sd_io_submit(sd_io_op_t op, const char *path, const void *data, size_t size, void *buf,
+                              size_t offset, bsp_sd_io_cb_t cb, void *user_ctx)
+{
+    if (s_io.ring == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const size_t data_size = (op == SD_IO_OP_WRITE) ? size : 0;
+    if (sizeof(sd_io_req_t) + data_size > xRingbufferGetMaxItemSize(s_io.ring)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    /* Never wait for room, a full buffer means the card cannot keep up */
+    void *item = NULL;
+    if (xRingbufferSendAcquire(s_io.ring, &item, sizeof(sd_io_req_t) + data_size, 0) != pdTRUE) {
+        portENTER_CRITICAL(&s_io.lock);
+        s_io.stats.rejected++;
+        portEXIT_CRITICAL(&s_io.lock);
+        return ESP_ERR_NO_MEM;
+    }
+
+    sd_io_req_t *req = item;
+    req->op = op;
+    req->size = size;
+    req->offset = offset;
+    req->buf = buf;
+    req->cb = cb;
+    req->user_ctx = user_ctx;
+    req->queued_us = esp_timer_get_time();
+    strlcpy(req->path, path ? path : "", sizeof(req->path));
+    if (data_size) {
+        memcpy(req->data, data, data_size);
+    }
+
+    /* Counted before the I/O task can see the request, so the levels never go below zero */
+    portENTER_CRITICAL(&s_io.lock);
+    s_io.stats.requests++;
+    s_io.stats.queue_depth++;
+    s_io.stats.queue_depth_max = LV_MAX(s_io.stats.queue_depth_max, s_io.stats.queue_depth);
+    s_io.stats.queued_bytes += data_size;
+    s_io.stats.queued_bytes_max = LV_MAX(s_io.stats.queued_bytes_max, s_io.stats.queued_bytes);
+    portEXIT_CRITICAL(&s_io.lock);
+
+    xRingbufferSendComplete(s_io.ring, item);
+    return ESP_OK;
+}
+
+static inline bool sd_io_path_valid(const char *path)
+{
+    return path != NULL && path[0] != '\0' && strlen(path) < BSP_SD_IO_PATH_MAX;
+}
+
+esp_err_t bsp_sd_io_write(const char *path, const void *data, size_t size, bsp_sd_io_cb_t cb, void *user_ctx)
+{
+    if (!sd_io_path_valid(path) || (data == NULL && size > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return sd_io_submit(SD_IO_OP_WRITE, path, data, size, NULL, 0, cb, user_ctx);
+}
+
+esp_err_t bsp_sd_io_read(const char *path, size_t offset, void *buf, size_t size, bsp_sd_io_cb_t cb,
+                         void *user_ctx)
+{
+    if (!sd_io_path_valid(path) || buf == NULL || cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return sd_io_submit(SD_IO_OP_READ, path, NULL, size, buf, offset, cb, user_ctx);
+}
+
+esp_err_t bsp_sd_io_truncate(const char *path, bsp_sd_io_cb_t cb, void *user_ctx)
+{
+    if (!sd_io_path_valid(path)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return sd_io_submit(SD_IO_OP_TRUNCATE, path, NULL, 0, NULL, 0, cb, user_ctx);
+}
+
+esp_err_t bsp_sd_io_flush(bsp_sd_io_cb_t cb, void *user_ctx)
+{
+    return sd_io_submit(SD_IO_OP_FLUSH, NULL, NULL, 0, NULL, 0, cb, user_ctx);
+}
+
+esp_err_t bsp_sd_io_get_stats(bsp_sd_io_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+    if (s_io.ring == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    portENTER_CRITICAL(&s_io.lock);
+    *stats = s_io.stats;
+    portEXIT_CRITICAL(&s_io.lock);
+    return ESP_OK;
+}
+
+void bsp_sd_io_reset_stats(void)
+{
+    portENTER_CRITICAL(&s_io.lock);
+    const uint32_t queue_depth = s_io.stats.queue_depth;
+    const uint32_t queued_bytes = s_io.stats.queued_bytes;
+    memset(&s_io.stats, 0, sizeof(s_io.stats));
+    s_io.stats.queue_depth = queue_depth;
+    s_io.stats.queue_depth_max = queue_depth;
+    s_io.stats.queued_bytes = queued_bytes;
+    s_io.stats.queued_bytes_max = queued_bytes;
+    portEXIT_CRITICAL(&s_io.lock);
+}
+
+esp_err_t bsp_sd_io_start(void)
+{
+    if (s_io.ring) {
+        return ESP_OK;
+    }
+
+    /* The request buffer is only a copy source, the chunks are written by DMA without a bounce buffer */
+    s_io.ring_storage = heap_caps_malloc(SD_IO_BUFFER_BYTES, SD_IO_BUFFER_CAPS);
+    s_io.chunks = heap_caps_malloc(CONFIG_BSP_SD_IO_OPEN_FILES * SD_IO_CHUNK_BYTES, MALLOC_CAP_DMA);
+    BSP_NULL_CHECK_GOTO(s_io.ring_storage, err);
+    BSP_NULL_CHECK_GOTO(s_io.chunks, err);
+    for (size_t i = 0; i < CONFIG_BSP_SD_IO_OPEN_FILES; i++) {
+        s_io.files[i].chunk = s_io.chunks + i * SD_IO_CHUNK_BYTES;
+    }
+
+    s_io.ring = xRingbufferCreateStatic(SD_IO_BUFFER_BYTES, RINGBUF_TYPE_NOSPLIT, s_io.ring_storage,
+                                        &s_io.ring_struct);
+    BSP_NULL_CHECK_GOTO(s_io.ring, err);
+    if (xTaskCreate(sd_io_task, "sd_io", SD_IO_TASK_STACK, NULL, CONFIG_BSP_SD_IO_TASK_PRIORITY,
+                    &s_io.task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create I/O task");
+        vRingbufferDelete(s_io.ring);
+        s_io.ring = NULL;
+        goto err;
+    }
+
+    ESP_LOGI(TAG, "%d kB request buffer, %d x %d kB write chunks", CONFIG_BSP_SD_IO_BUFFER_KB,
+             CONFIG_BSP_SD_IO_OPEN_FILES, CONFIG_BSP_SD_IO_CHUNK_KB);
+    return ESP_OK;
+
+err:
+    heap_caps_free(s_io.chunks);
+    heap_caps_free(s_io.ring_storage);
+    s_io.chunks = NULL;
+    s_io.ring_storage = NULL;
+    return ESP_ERR_NO_MEM;
+}
+#endif // CONFIG_BSP_SD_IO
@@ -0,0 +1,590 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_SD_LOG
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_idf_version.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_random.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 0)
+#include "esp_vfs_fat.h"
+#endif
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_sd_log";
+
+#define SD_LOG_TASK_STACK       (4096)
+#define SD_LOG_RECORD_SIZE      (CONFIG_BSP_SD_LOG_RECORD_SIZE)
+#define SD_LOG_RING_RECORDS     (CONFIG_BSP_SD_LOG_RING_RECORDS)
+#define SD_LOG_BLOCK_BYTES      (CONFIG_BSP_SD_LOG_BLOCK_KB * 1024)
+#define SD_LOG_FILE_BYTES       ((long)CONFIG_BSP_SD_LOG_FILE_MB * 1024 * 1024)
+#define SD_LOG_FILE_BLOCKS      (SD_LOG_FILE_BYTES / SD_LOG_BLOCK_BYTES)
+#define SD_LOG_BLOCK_RECORDS    ((SD_LOG_BLOCK_BYTES - sizeof(bsp_sd_log_block_t)) / SD_LOG_RECORD_SIZE)
+#define SD_LOG_CELL_BYTES       ((sizeof(atomic_uint) + SD_LOG_RECORD_SIZE + 3) & ~3)
+#define SD_LOG_PATH_FORMAT      BSP_MOUNT_POINT "/log%05" PRIu32 ".bin"
+#define SD_LOG_PATH_MAX         (sizeof(BSP_MOUNT_POINT) + 13)
+
+#if CONFIG_SPIRAM
+#define SD_LOG_RING_CAPS        (MALLOC_CAP_SPIRAM)
+#else
+#define SD_LOG_RING_CAPS        (MALLOC_CAP_DEFAULT)
+#endif
+
+_Static_assert((SD_LOG_RING_RECORDS & (SD_LOG_RING_RECORDS - 1)) == 0,
+               "BSP_SD_LOG_RING_RECORDS must be a power of two");
+_Static_assert(SD_LOG_BLOCK_RECORDS > 0, "BSP_SD_LOG_RECORD_SIZE does not fit in a block");
+
+/* Ring cell, seq tells whose turn it is: pos when free for the writer of pos, pos + 1 once written */
+typedef struct {
+    atomic_uint seq;
+    uint8_t data[];
+} sd_log_cell_t;
+
+static struct {
+    uint8_t *ring;                      // SD_LOG_RING_RECORDS cells
+    atomic_uint head;                   // Next position to reserve, shared by all writers
+    uint32_t tail;                      // Next position to read, writer task only
+    atomic_uint records;
+    atomic_uint dropped;
+    atomic_bool flush;
+    volatile bool running;
+    volatile bool stop;
+    SemaphoreHandle_t stopped;
+    uint8_t *block;                     // DMA capable, header and records
+    uint32_t fill;                      // Records in block
+    FILE *f;
+    uint32_t file_num;
+    uint32_t block_index;               // Next block in the file
+    uint32_t seq;                       // Sequence number of the next block
+    bool dirty;                         // Blocks written since the last sync
+    portMUX_TYPE lock;                  // Protects stats
+    bsp_sd_log_stats_t stats;           // Writer task side, records and dropped are the atomics above
+} s_log = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static inline sd_log_cell_t *sd_log_cell(uint32_t pos)
+{
+    return (sd_log_cell_t *)(s_log.ring + (pos & (SD_LOG_RING_RECORDS - 1)) * SD_LOG_CELL_BYTES);
+}
+
+esp_err_t bsp_sd_log_write(const void *record)
+{
+    if (!s_log.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* Reserve a cell: claim the position whose cell is free, retry when another writer was faster */
+    sd_log_cell_t *cell;
+    uint32_t pos = atomic_load_explicit(&s_log.head, memory_order_relaxed);
+    while (true) {
+        cell = sd_log_cell(pos);
+        const int32_t diff = (int32_t)(atomic_load_explicit(&cell->seq, memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&s_log.head, &pos, pos + 1, memory_order_relaxed,
+                    memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            atomic_fetch_add_explicit(&s_log.dropped, 1, memory_order_relaxed);
+            return ESP_ERR_NO_MEM;
+        } else {
+            pos = atomic_load_explicit(&s_log.head, memory_order_relaxed);
+        }
+    }
+
+    memcpy(cell->data, record, SD_LOG_RECORD_SIZE);
+    atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+    atomic_fetch_add_explicit(&s_log.records, 1, memory_order_relaxed);
+    return ESP_OK;
+}
+
+/* Move the next record into the block, writer task only */
+static bool sd_log_pop(uint8_t *dst)
+{
+    sd_log_cell_t *cell = sd_log_cell(s_log.tail);
+    if (atomic_load_explicit(&cell->seq, memory_order_acquire) != s_log.tail + 1) {
+        return false;
+    }
+    memcpy(dst, cell->data, SD_LOG_RECORD_SIZE);
+    atomic_store_explicit(&cell->seq, s_log.tail + SD_LOG_RING_RECORDS, memory_order_release);
+    s_log.tail++;
+    return true;
+}
+
+static void sd_log_count_error(void)
+{
+    portENTER_CRITICAL(&s_log.lock);
+    s_log.stats.errors++;
+    portEXIT_CRITICAL(&s_log.lock);
+}
+
+static void sd_log_path(char *path, uint32_t num)
+{
+    snprintf(path, SD_LOG_PATH_MAX, SD_LOG_PATH_FORMAT, num);
+}
+
+/* Create a log file with all its clusters allocated, the old one SD_LOG_FILES back is deleted first */
+static FILE *sd_log_create(uint32_t num)
+{
+    char path[SD_LOG_PATH_MAX];
+    if (num > CONFIG_BSP_SD_LOG_FILES) {
+        sd_log_path(path, num - CONFIG_BSP_SD_LOG_FILES);
+        unlink(path);
+    }
+
+    sd_log_path(path, num);
+    const int64_t start = esp_timer_get_time();
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 0)
+    /* One contiguous run of clusters (f_expand) when the card still has one that large */
+    unlink(path);
+    const bool contiguous = esp_vfs_fat_create_contiguous_file(BSP_MOUNT_POINT, path, SD_LOG_FILE_BYTES,
+                            true) == ESP_OK;
+    FILE *f = fopen(path, contiguous ? "r+b" : "wb");
+#else
+    const bool contiguous = false;
+    FILE *f = fopen(path, "wb");
+#endif
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Creating %s failed", path);
+        return NULL;
+    }
+    setvbuf(f, NULL, _IONBF, 0);
+    /* Otherwise seeking past the end of a file open for writing makes FATFS allocate the clusters without
+     * writing them, wherever it finds free ones. Either way they still hold what the unlinked log left there,
+     * so block 0 gets an empty header: until the first block is written, neither the resume nor the dump
+     * tool can take stale blocks for this log. */
+    static const bsp_sd_log_block_t empty;
+    if ((!contiguous && (fseek(f, SD_LOG_FILE_BYTES - 1, SEEK_SET) != 0 || fputc(0, f) == EOF)) ||
+            fseek(f, 0, SEEK_SET) != 0 || fwrite(&empty, sizeof(empty), 1, f) != 1 || fsync(fileno(f)) != 0) {
+        ESP_LOGE(TAG, "Preallocating %ld B for %s failed", SD_LOG_FILE_BYTES, path);
+        fclose(f);
+        unlink(path);
+        return NULL;
+    }
+    ESP_LOGI(TAG, "%s preallocated%s in %lld ms", path, contiguous ? " contiguous" : ", possibly fragmented",
+             (esp_timer_get_time() - start) / 1000);
+    return f;
+}
+
+static inline bool sd_log_header_valid(const bsp_sd_log_block_t *header)
+{
+    return header->magic == BSP_SD_LOG_MAGIC && header->record_size == SD_LOG_RECORD_SIZE &&
+           header->records <= SD_LOG_BLOCK_RECORDS;
+}
+
+static bool sd_log_read_header(FILE *f, uint32_t index, bsp_sd_log_block_t *header)
+{
+    return fseek(f, (long)index * SD_LOG_BLOCK_BYTES, SEEK_SET) == 0 &&
+           fread(header, sizeof(*header), 1, f) == 1 && sd_log_header_valid(header);
+}
+
+static bool sd_log_check_block(FILE *f, uint32_t index, uint8_t *block)
+{
+    const bsp_sd_log_block_t *header = (const bsp_sd_log_block_t *)block;
+    return fseek(f, (long)index * SD_LOG_BLOCK_BYTES, SEEK_SET) == 0 &&
+           fread(block, 1, SD_LOG_BLOCK_BYTES, f) == SD_LOG_BLOCK_BYTES && sd_log_header_valid(header) &&
+           header->crc32 == esp_rom_crc32_le(0, block + sizeof(*header), header->records * SD_LOG_RECORD_SIZE);
+}
+
+/* Number of the newest log file, 0 when there is none */
+static uint32_t sd_log_newest(void)
+{
+    uint32_t newest = 0;
+    DIR *dir = opendir(BSP_MOUNT_POINT);
+    if (dir == NULL) {
+        return 0;
+    }
+    const struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        /* Short names come back in upper case */
+        uint32_t num;
+        char ext[5];
+        if (strncasecmp(entry->d_name, "log", 3) == 0 &&
+                sscanf(entry->d_name + 3, "%5" SCNu32 "%4s", &num, ext) == 2 && strcasecmp(ext, ".bin") == 0) {
+            newest = LV_MAX(newest, num);
+        }
+    }
+    closedir(dir);
+    return newest;
+}
+
+/* Open the newest log file after its last intact block, or start a new one */
+static esp_err_t sd_log_resume(void)
+{
+    const uint32_t num = sd_log_newest();
+    char path[SD_LOG_PATH_MAX];
+    sd_log_path(path, num);
+    FILE *f = num ? fopen(path, "r+b") : NULL;
+    bsp_sd_log_block_t first;
+    if (f) {
+        setvbuf(f, NULL, _IONBF, 0);
+        if (fseek(f, 0, SEEK_END) != 0 || ftell(f) != SD_LOG_FILE_BYTES || !sd_log_read_header(f, 0, &first)) {
+            /* Other size or nothing written yet: a new file keeps the block offsets simple */
+            fclose(f);
+            f = NULL;
+        }
+    }
+
+    if (f) {
+        /* Blocks are written in order, so the intact ones are the prefix whose sequence numbers follow
+         * the first block. Stale blocks from a deleted file do not continue the sequence. */
+        uint32_t lo = 0, hi = SD_LOG_FILE_BLOCKS - 1;
+        while (lo < hi) {
+            const uint32_t mid = lo + (hi - lo + 1) / 2;
+            bsp_sd_log_block_t header;
+            if (sd_log_read_header(f, mid, &header) && header.seq == first.seq + mid) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        /* Only the last block can be torn by a power cut */
+        uint32_t next = lo + 1;
+        if (!sd_log_check_block(f, lo, s_log.block)) {
+            ESP_LOGW(TAG, "Block %" PRIu32 " of %s is torn, overwriting it", lo, path);
+            next = lo;
+        }
+        s_log.f = f;
+        s_log.file_num = num;
+        s_log.block_index = next;
+        s_log.seq = first.seq + next;
+        ESP_LOGI(TAG, "Resuming %s at block %" PRIu32 "/%ld", path, s_log.block_index, SD_LOG_FILE_BLOCKS);
+        return ESP_OK;
+    }
+
+    /* A new log starts at a random sequence number, so stale blocks of an old log never chain to it */
+    s_log.f = sd_log_create(num + 1);
+    if (s_log.f == NULL) {
+        return ESP_FAIL;
+    }
+    s_log.file_num = num + 1;
+    s_log.block_index = 0;
+    s_log.seq = esp_random();
+    s_log.stats.files++;
+    return ESP_OK;
+}
+
+static esp_err_t sd_log_write_block(bool partial)
+{
+    if (s_log.block_index == SD_LOG_FILE_BLOCKS) {
+        FILE *f = sd_log_create(s_log.file_num + 1);
+        if (f == NULL) {
+            sd_log_count_error();
+            return ESP_FAIL;
+        }
+        fclose(s_log.f);
+        s_log.f = f;
+        s_log.file_num++;
+        s_log.block_index = 0;
+        s_log.dirty = false;
+        portENTER_CRITICAL(&s_log.lock);
+        s_log.stats.files++;
+        portEXIT_CRITICAL(&s_log.lock);
+    }
+
+    bsp_sd_log_block_t *header = (bsp_sd_log_block_t *)s_log.block;
+    const size_t used = s_log.fill * SD_LOG_RECORD_SIZE;
+    header->magic = BSP_SD_LOG_MAGIC;
+    header->seq = s_log.seq;
+    header->record_size = SD_LOG_RECORD_SIZE;
+    header->records = s_log.fill;
+    header->crc32 = esp_rom_crc32_le(0, s_log.block + sizeof(*header), used);
+    memset(s_log.block + sizeof(*header) + used, 0, SD_LOG_BLOCK_BYTES - sizeof(*header) - used);
+
+    /* Whole aligned blocks go from the DMA capable buffer to the card without FATFS copying them */
+    const int64_t start = esp_timer_get_time();
+    const bool ok = fseek(s_log.f, (long)s_log.block_index * SD_LOG_BLOCK_BYTES, SEEK_SET) == 0 &&
+                    fwrite(s_log.block, 1, SD_LOG_BLOCK_BYTES, s_log.f) == SD_LOG_BLOCK_BYTES;
+    const uint32_t elapsed_us = esp_timer_get_time() - start;
+
+    portENTER_CRITICAL(&s_log.lock);
+    s_log.stats.block_us_max = LV_MAX(s_log.stats.block_us_max, elapsed_us);
+    if (ok) {
+        s_log.stats.blocks++;
+        s_log.stats.partial_blocks += partial;
+        s_log.stats.records_written += s_log.fill;
+    } else {
+        s_log.stats.errors++;
+    }
+    portEXIT_CRITICAL(&s_log.lock);
+
+    /* A failed block is dropped rather than retried forever, the sequence stays continuous */
+    s_log.block_index++;
+    s_log.seq++;
+    s_log.fill = 0;
+    s_log.dirty = true;
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+static void sd_log_sync(void)
+{
+    if (!s_log.dirty) {
+        return;
+    }
+    const int64_t start = esp_timer_get_time();
+    if (fsync(fileno(s_log.f)) != 0) {
+        sd_log_count_error();
+    }
+    const uint32_t elapsed_us = esp_timer_get_time() - start;
+    portENTER_CRITICAL(&s_log.lock);
+    s_log.stats.syncs++;
+    s_log.stats.sync_us_max = LV_MAX(s_log.stats.sync_us_max, elapsed_us);
+    portEXIT_CRITICAL(&s_log.lock);
+    s_log.dirty = false;
+}
+
+static void sd_log_task(void *arg)
+{
+    uint8_t *records = s_log.block + sizeof(bsp_sd_log_block_t);
+    int64_t last_sync = esp_timer_get_time();
+    while (true) {
+        const bool stop = s_log.stop;
+        const uint32_t pending = atomic_load_explicit(&s_log.head, memory_order_relaxed) - s_log.tail;
+        portENTER_CRITICAL(&s_log.lock);
+        s_log.stats.ring_max = LV_MAX(s_log.stats.ring_max, pending);
+        portEXIT_CRITICAL(&s_log.lock);
+
+        bool moved = false;
+        while (s_log.fill < SD_LOG_BLOCK_RECORDS && sd_log_pop(records + s_log.fill * SD_LOG_RECORD_SIZE)) {
+            s_log.fill++;
+            moved = true;
+        }
+        if (s_log.fill == SD_LOG_BLOCK_RECORDS) {
+            sd_log_write_block(false);
+        }
+
+        if (stop && atomic_load_explicit(&s_log.head, memory_order_relaxed) != s_log.tail) {
+            /* Drain the ring before the last block, including records still being copied in */
+            if (!moved) {
+                vTaskDelay(1);
+            }
+            continue;
+        }
+
+        const int64_t now = esp_timer_get_time();
+        const bool flush = atomic_exchange(&s_log.flush, false);
+        if (stop || flush || now - last_sync >= CONFIG_BSP_SD_LOG_SYNC_MS * 1000LL) {
+            if (s_log.fill) {
+                sd_log_write_block(true);
+            }
+            sd_log_sync();
+            last_sync = now;
+            if (stop) {
+                break;
+            }
+        }
+        if (!moved) {
+            vTaskDelay(pdMS_TO_TICKS(CONFIG_BSP_SD_LOG_POLL_MS));
+        }
+    }
+
+    fclose(s_log.f);
+    s_log.f = NULL;
+    xSemaphoreGive(s_log.stopped);
+    vTaskDelete(NULL);
+}
+
+void bsp_sd_log_flush(void)
+{
+    atomic_store(&s_log.flush, true);
+}
+
+esp_err_t bsp_sd_log_get_stats(bsp_sd_log_stats_t *stats)
+{
+    BSP_NULL_CHECK(stats, ESP_ERR_INVALID_ARG);
+    portENTER_CRITICAL(&s_log.lock);
+    *stats = s_log.stats;
+    portEXIT_CRITICAL(&s_log.lock);
+    stats->records = atomic_load(&s_log.records);
+    stats->dropped = atomic_load(&s_log.dropped);
+    stats->seq = s_log.seq;
+    return ESP_OK;
+}
+
+/* The ring stays allocated, a writer may still be past its running check when the logger stops */
+static void sd_log_free(void)
+{
+    heap_caps_free(s_log.block);
+    if (s_log.stopped) {
+        vSemaphoreDelete(s_log.stopped);
+    }
+    s_log.block = NULL;
+    s_log.stopped = NULL;
+}
+
+esp_err_t bsp_sd_log_start(void)
+{
+    if (s_log.running || bsp_sdcard == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (s_log.ring == NULL) {
+        s_log.ring = heap_caps_malloc(SD_LOG_RING_RECORDS * SD_LOG_CELL_BYTES, SD_LOG_RING_CAPS);
+    }
+    s_log.block = heap_caps_malloc(SD_LOG_BLOCK_BYTES, MALLOC_CAP_DMA);
+    s_log.stopped = xSemaphoreCreateBinary();
+    if (s_log.ring == NULL || s_log.block == NULL || s_log.stopped == NULL) {
+        sd_log_free();
+        return ESP_ERR_NO_MEM;
+    }
+    for (uint32_t i = 0; i < SD_LOG_RING_RECORDS; i++) {
+        atomic_init(&sd_log_cell(i)->seq, i);
+    }
+    atomic_store(&s_log.head, 0);
+    s_log.tail = 0;
+    s_log.fill = 0;
+    s_log.dirty = false;
+    s_log.stop = false;
+    atomic_store(&s_log.flush, false);
+
+    esp_err_t ret = sd_log_resume();
+    if (ret != ESP_OK) {
+        sd_log_free();
+        return ret;
+    }
+
+    s_log.running = true;
+    if (xTaskCreate(sd_log_task, "sd_log", SD_LOG_TASK_STACK, NULL, CONFIG_BSP_SD_LOG_TASK_PRIORITY,
+                    NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create writer task");
+        s_log.running = false;
+        fclose(s_log.f);
+        s_log.f = NULL;
+        sd_log_free();
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_sd_log_stop(void)
+{
+    if (!s_log.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    /* Writers that passed the running check still complete their record, the task drains them */
+    s_log.running = false;
+    s_log.stop = true;
+    xSemaphoreTake(s_log.stopped, portMAX_DELAY);
+    sd_log_free();
+    return ESP_OK;
+}
+
+#if CONFIG_BSP_SD_LOG_BENCHMARK
+#define BENCH_FILE              BSP_MOUNT_POINT "/logbench.bin"
+#define BENCH_RECORDS           (CONFIG_BSP_SD_LOG_BENCHMARK_RECORDS)
+
+/* Baseline: every record appended with fwrite() to a file that grows, synced like the logger */
+static esp_err_t bench_fwrite(const uint8_t *record, bsp_sd_log_bench_result_t *result)
+{
+    FILE *f = fopen(BENCH_FILE, "wb");
+    if (f == NULL) {
+        return ESP_FAIL;
+    }
+    esp_err_t ret = ESP_OK;
+    uint64_t total_us = 0;
+    const int64_t start = esp_timer_get_time();
+    int64_t last_sync = start;
+    for (uint32_t i = 0; i < BENCH_RECORDS && ret == ESP_OK; i++) {
+        const int64_t call = esp_timer_get_time();
+        if (fwrite(record, 1, SD_LOG_RECORD_SIZE, f) != SD_LOG_RECORD_SIZE) {
+            ret = ESP_FAIL;
+        }
+        if (call - last_sync >= CONFIG_BSP_SD_LOG_SYNC_MS * 1000LL) {
+            fflush(f);
+            fsync(fileno(f));
+            last_sync = call;
+        }
+        const uint32_t elapsed_us = esp_timer_get_time() - call;
+        total_us += elapsed_us;
+        result->fwrite_us_max = LV_MAX(result->fwrite_us_max, elapsed_us);
+    }
+    fflush(f);
+    fsync(fileno(f));
+    const int64_t end = esp_timer_get_time();
+    fclose(f);
+    unlink(BENCH_FILE);
+
+    result->fwrite_us_avg = total_us / BENCH_RECORDS;
+    result->fwrite_mbps = (float)BENCH_RECORDS * SD_LOG_RECORD_SIZE / (end - start);
+    return ret;
+}
+
+static esp_err_t bench_log(const uint8_t *record, bsp_sd_log_bench_result_t *result)
+{
+    bsp_sd_log_stats_t stats;
+    bsp_sd_log_get_stats(&stats);
+    const uint32_t written_before = stats.records_written;
+
+    uint64_t total_us = 0;
+    const int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i < BENCH_RECORDS; i++) {
+        const int64_t call = esp_timer_get_time();
+        while (bsp_sd_log_write(record) == ESP_ERR_NO_MEM) {
+            /* Full ring: a real producer would drop, the benchmark waits to measure throughput */
+            result->log_retries++;
+            vTaskDelay(1);
+        }
+        const uint32_t elapsed_us = esp_timer_get_time() - call;
+        total_us += elapsed_us;
+        result->log_us_max = LV_MAX(result->log_us_max, elapsed_us);
+    }
+    bsp_sd_log_flush();
+    do {
+        vTaskDelay(pdMS_TO_TICKS(CONFIG_BSP_SD_LOG_POLL_MS));
+        bsp_sd_log_get_stats(&stats);
+    } while (stats.records_written - written_before < BENCH_RECORDS && stats.errors == 0);
+    const int64_t end = esp_timer_get_time();
+
+    result->log_us_avg = total_us / BENCH_RECORDS;
+    result->log_mbps = (float)BENCH_RECORDS * SD_LOG_RECORD_SIZE / (end - start);
+    return (stats.errors == 0) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t bsp_sd_log_benchmark(bsp_sd_log_bench_result_t *result)
+{
+    const bool started = !s_log.running;
+    if (started) {
+        BSP_ERROR_CHECK_RETURN_ERR(bsp_sd_log_start());
+    }
+
+    uint8_t record[SD_LOG_RECORD_SIZE];
+    esp_fill_random(record, sizeof(record));
+    bsp_sd_log_bench_result_t res = { .records = BENCH_RECORDS };
+    esp_err_t ret = bench_fwrite(record, &res);
+    if (ret == ESP_OK) {
+        ret = bench_log(record, &res);
+    }
+    if (started) {
+        bsp_sd_log_stop();
+    }
+
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "%" PRIu32 " records of %d B:", res.records, SD_LOG_RECORD_SIZE);
+        ESP_LOGI(TAG, "          | MB/s  | avg call [us] | max call [us]");
+        ESP_LOGI(TAG, " fwrite   | %5.2f | %13" PRIu32 " | %13" PRIu32, res.fwrite_mbps, res.fwrite_us_avg,
+                 res.fwrite_us_max);
+        ESP_LOGI(TAG, " sd_log   | %5.2f | %13" PRIu32 " | %13" PRIu32 " (%" PRIu32 " waits for a full ring)",
+                 res.log_mbps, res.log_us_avg, res.log_us_max, res.log_retries);
+        if (result) {
+            *result = res;
+        }
+    }
+    return ret;
+}
+#endif // CONFIG_BSP_SD_LOG_BENCHMARK
+#endif // CONFIG_BSP_SD_LOG
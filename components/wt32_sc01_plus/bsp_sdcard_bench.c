@@ -0,0 +1,181 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_SD_BENCHMARK
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_sdcard.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_sd_bench";
+
+#define BENCH_FILE              BSP_MOUNT_POINT "/sd_bench.bin"
+#define BENCH_FILE_BYTES        (CONFIG_BSP_SD_BENCHMARK_FILE_KB * 1024)
+#define BENCH_IO_BYTES          (CONFIG_BSP_SD_BENCHMARK_IO_KB * 1024)
+#define BENCH_RANDOM_IO_BYTES   (4096)
+
+/* Every sequential transfer starts with its index, so misplaced data is caught on read */
+static inline void bench_stamp(uint8_t *buf, uint32_t index)
+{
+    memcpy(buf, &index, sizeof(index));
+}
+
+static FILE *bench_open(const char *mode)
+{
+    FILE *f = fopen(BENCH_FILE, mode);
+    if (f) {
+        /* Transfers go straight to FATFS, the stdio buffer would only add a copy */
+        setvbuf(f, NULL, _IONBF, 0);
+    }
+    return f;
+}
+
+static esp_err_t bench_seq_write(uint8_t *buf, int64_t *elapsed_us)
+{
+    FILE *f = bench_open("wb");
+    if (f == NULL) {
+        return ESP_FAIL;
+    }
+    esp_err_t ret = ESP_OK;
+    const int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i < BENCH_FILE_BYTES / BENCH_IO_BYTES && ret == ESP_OK; i++) {
+        bench_stamp(buf, i);
+        if (fwrite(buf, 1, BENCH_IO_BYTES, f) != BENCH_IO_BYTES) {
+            ret = ESP_FAIL;
+        }
+    }
+    if (ret == ESP_OK && fsync(fileno(f)) != 0) {
+        ret = ESP_FAIL;
+    }
+    fclose(f);
+    *elapsed_us = esp_timer_get_time() - start;
+    return ret;
+}
+
+static esp_err_t bench_seq_read(uint8_t *buf, int64_t *elapsed_us)
+{
+    FILE *f = bench_open("rb");
+    if (f == NULL) {
+        return ESP_FAIL;
+    }
+    esp_err_t ret = ESP_OK;
+    const int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i < BENCH_FILE_BYTES / BENCH_IO_BYTES && ret == ESP_OK; i++) {
+        uint32_t index;
+        if (fread(buf, 1, BENCH_IO_BYTES, f) != BENCH_IO_BYTES) {
+            ret = ESP_FAIL;
+            break;
+        }
+        memcpy(&index, buf, sizeof(index));
+        if (index != i) {
+            ESP_LOGE(TAG, "Transfer %" PRIu32 " read back as %" PRIu32, i, index);
+            ret = ESP_ERR_INVALID_CRC;
+        }
+    }
+    *elapsed_us = esp_timer_get_time() - start;
+    fclose(f);
+    return ret;
+}
+
+/* CONFIG_BSP_SD_BENCHMARK_RANDOM_OPS 4 kB transfers at random aligned offsets of the test file */
+static esp_err_t bench_random(uint8_t *buf, bool write, int64_t *elapsed_us)
+{
+    FILE *f = bench_open(write ? "r+b" : "rb");
+    if (f == NULL) {
+        return ESP_FAIL;
+    }
+    esp_err_t ret = ESP_OK;
+    const uint32_t blocks = BENCH_FILE_BYTES / BENCH_RANDOM_IO_BYTES;
+    const int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i < CONFIG_BSP_SD_BENCHMARK_RANDOM_OPS && ret == ESP_OK; i++) {
+        const long offset = (long)(esp_random() % blocks) * BENCH_RANDOM_IO_BYTES;
+        const size_t n = (fseek(f, offset, SEEK_SET) != 0) ? 0 :
+                         write ? fwrite(buf, 1, BENCH_RANDOM_IO_BYTES, f) : fread(buf, 1, BENCH_RANDOM_IO_BYTES, f);
+        if (n != BENCH_RANDOM_IO_BYTES) {
+            ret = ESP_FAIL;
+        }
+    }
+    if (ret == ESP_OK && write && fsync(fileno(f)) != 0) {
+        ret = ESP_FAIL;
+    }
+    *elapsed_us = esp_timer_get_time() - start;
+    fclose(f);
+    return ret;
+}
+
+static esp_err_t bench_run_clock(uint32_t freq_khz, uint8_t *buf, bsp_sdcard_benchmark_result_t *result)
+{
+    BSP_ERROR_CHECK_RETURN_ERR(bsp_sdcard_mount_freq(freq_khz));
+
+    int64_t seq_write_us = 0, seq_read_us = 0, rand_write_us = 0, rand_read_us = 0;
+    esp_fill_random(buf, BENCH_IO_BYTES);
+    esp_err_t ret = bench_seq_write(buf, &seq_write_us);
+    if (ret == ESP_OK) {
+        ret = bench_seq_read(buf, &seq_read_us);
+    }
+    if (ret == ESP_OK) {
+        ret = bench_random(buf, true, &rand_write_us);
+    }
+    if (ret == ESP_OK) {
+        ret = bench_random(buf, false, &rand_read_us);
+    }
+
+    if (ret == ESP_OK) {
+        result->freq_khz = freq_khz;
+        result->card_freq_khz = bsp_sdcard->max_freq_khz;
+        result->seq_write_mbps = (float)BENCH_FILE_BYTES / seq_write_us;
+        result->seq_read_mbps = (float)BENCH_FILE_BYTES / seq_read_us;
+        result->rand_write_iops = CONFIG_BSP_SD_BENCHMARK_RANDOM_OPS * 1000000.0f / rand_write_us;
+        result->rand_read_iops = CONFIG_BSP_SD_BENCHMARK_RANDOM_OPS * 1000000.0f / rand_read_us;
+    }
+
+    unlink(BENCH_FILE);
+    const esp_err_t unmount_ret = bsp_sdcard_unmount();
+    return (ret != ESP_OK) ? ret : unmount_ret;
+}
+
+esp_err_t bsp_sdcard_benchmark(const uint32_t *freq_khz, size_t count, bsp_sdcard_benchmark_result_t *results)
+{
+    BSP_NULL_CHECK(freq_khz, ESP_ERR_INVALID_ARG);
+
+    /* Multi-sector transfers of FATFS go to the driver without a copy when the buffer is DMA capable */
+    uint8_t *buf = heap_caps_malloc(BENCH_IO_BYTES, MALLOC_CAP_DMA);
+    BSP_NULL_CHECK(buf, ESP_ERR_NO_MEM);
+
+    const bool was_mounted = (bsp_sdcard != NULL);
+    esp_err_t ret = was_mounted ? bsp_sdcard_unmount() : ESP_OK;
+
+    ESP_LOGI(TAG, "uSD benchmark: %d kB file, %d kB sequential and 4 kB random transfers, %d max transfer",
+             CONFIG_BSP_SD_BENCHMARK_FILE_KB, CONFIG_BSP_SD_BENCHMARK_IO_KB, CONFIG_BSP_SD_MAX_TRANSFER_SIZE);
+    ESP_LOGI(TAG, " SPI [kHz] | card [kHz] | write [MB/s] | read [MB/s] | write [IOPS] | read [IOPS]");
+    for (size_t i = 0; i < count && ret == ESP_OK; i++) {
+        bsp_sdcard_benchmark_result_t result = { 0 };
+        ret = bench_run_clock(freq_khz[i], buf, &result);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, " %9" PRIu32 " | failed (%s)", freq_khz[i], esp_err_to_name(ret));
+            break;
+        }
+        ESP_LOGI(TAG, " %9" PRIu32 " | %10" PRIu32 " | %12.2f | %11.2f | %12.0f | %11.0f", result.freq_khz,
+                 result.card_freq_khz, result.seq_write_mbps, result.seq_read_mbps, result.rand_write_iops,
+                 result.rand_read_iops);
+        if (results) {
+            results[i] = result;
+        }
+    }
+
+    heap_caps_free(buf);
+    if (was_mounted && bsp_sdcard == NULL) {
+        const esp_err_t mount_ret = bsp_sdcard_mount();
+        ret = (ret != ESP_OK) ? ret : mount_ret;
+    }
+    return ret;
+}
+#endif // CONFIG_BSP_SD_BENCHMARK
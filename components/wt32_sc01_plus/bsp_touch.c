@@ -0,0 +1,128 @@
+#include "sdkconfig.h"
+
+#if CONFIG_BSP_TOUCH_IRQ
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_err.h"
+#include "esp_log.h"
+
+#include "esp_lvgl_port.h"
+#include "bsp_touch.h"
+#include "bsp_display_latency.h"
+#include "bsp_err_check.h"
+
+static const char *TAG = "SC01_Plus_touch";
+
+typedef struct {
+    bool pressed;
+    uint16_t x;
+    uint16_t y;
+} bsp_touch_event_t;
+
+static struct {
+    esp_lcd_touch_handle_t tp;
+    lv_indev_t *indev;
+    QueueHandle_t queue;        // Events read from the controller, not yet taken by LVGL
+    TaskHandle_t task;
+    bsp_touch_event_t last;     // Last event taken by LVGL
+} s_touch;
+
+void bsp_touch_isr(esp_lcd_touch_handle_t tp)
+{
+    BaseType_t need_yield = pdFALSE;
+#if CONFIG_BSP_DISPLAY_LATENCY
+    bsp_display_latency_touch_edge();
+#endif
+    if (s_touch.task) {
+        vTaskNotifyGiveFromISR(s_touch.task, &need_yield);
+    }
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/* Queue the event, the oldest one is dropped when LVGL falls behind */
+static void bsp_touch_push(const bsp_touch_event_t *event)
+{
+    while (xQueueSend(s_touch.queue, event, 0) != pdTRUE) {
+        bsp_touch_event_t dropped;
+        xQueueReceive(s_touch.queue, &dropped, 0);
+    }
+}
+
+static void bsp_touch_task(void *arg)
+{
+    bsp_touch_event_t state = { 0 };
+
+    while (true) {
+        /* No I2C traffic until the controller pulls INT low, then read until the touch is released */
+        ulTaskNotifyTake(pdTRUE, state.pressed ? pdMS_TO_TICKS(CONFIG_BSP_TOUCH_IRQ_POLL_MS) : portMAX_DELAY);
+        if (esp_lcd_touch_read_data(s_touch.tp) != ESP_OK) {
+            continue;
+        }
+
+        bsp_touch_event_t event = { 0 };
+        uint8_t count = 0;
+        event.pressed = esp_lcd_touch_get_coordinates(s_touch.tp, &event.x, &event.y, NULL, &count, 1) && count > 0;
+        if (!event.pressed) {
+            event.x = state.x;
+            event.y = state.y;
+        }
+        if (event.pressed == state.pressed && event.x == state.x && event.y == state.y) {
+            continue;
+        }
+        state = event;
+        bsp_touch_push(&event);
+
+        /* Process the input now instead of on the next LVGL input period */
+        if (lvgl_port_lock(0)) {
+            lv_indev_read_timer_cb(s_touch.indev->driver->read_timer);
+            lvgl_port_unlock();
+        }
+    }
+}
+
+static void bsp_touch_indev_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+    if (xQueueReceive(s_touch.queue, &s_touch.last, 0) == pdTRUE) {
+        /* Let LVGL see every queued event, a short tap is a press and a release */
+        data->continue_reading = uxQueueMessagesWaiting(s_touch.queue) > 0;
+    }
+    data->point.x = s_touch.last.x;
+    data->point.y = s_touch.last.y;
+    data->state = s_touch.last.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+lv_indev_t *bsp_touch_indev_init(lv_disp_t *disp, esp_lcd_touch_handle_t tp)
+{
+    BSP_NULL_CHECK(tp, NULL);
+    s_touch.tp = tp;
+    s_touch.queue = xQueueCreate(CONFIG_BSP_TOUCH_IRQ_QUEUE_LEN, sizeof(bsp_touch_event_t));
+    BSP_NULL_CHECK(s_touch.queue, NULL);
+
+    static lv_indev_drv_t indev_drv;
+    lv_indev_drv_init(&indev_drv);
+    indev_drv.type = LV_INDEV_TYPE_POINTER;
+    indev_drv.disp = disp;
+    indev_drv.read_cb = bsp_touch_indev_read;
+
+    lvgl_port_lock(0);
+    s_touch.indev = lv_indev_drv_register(&indev_drv);
+    lvgl_port_unlock();
+    BSP_NULL_CHECK(s_touch.indev, NULL);
+
+    if (xTaskCreate(bsp_touch_task, "touch", CONFIG_BSP_TOUCH_TASK_STACK, NULL, CONFIG_BSP_TOUCH_TASK_PRIORITY,
+                    &s_touch.task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create touch task");
+        return NULL;
+    }
+
+    /* A touch that started before the task existed has no falling edge left, read once */
+    xTaskNotifyGive(s_touch.task);
+
+    ESP_LOGI(TAG, "Touch read on interrupt, %d ms period while touched", CONFIG_BSP_TOUCH_IRQ_POLL_MS);
+    return s_touch.indev;
+}
+#endif // CONFIG_BSP_TOUCH_IRQ
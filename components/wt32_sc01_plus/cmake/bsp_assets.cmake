@@ -0,0 +1,65 @@
+# Build-time packing of the assets partition
+#
+#   bsp_add_assets(PARTITION <label> FILES <file>... [RLE] [FLASH_IN_PROJECT])
+#
+# PNG files become images in the LVGL color format of the project, other files are stored as they
+# are (see tools/pack_assets.py). The image is built into <build>/<label>.bin and flashed with
+# `idf.py <label>-flash`, without the app, or with `idf.py flash` when FLASH_IN_PROJECT is given.
+# The firmware maps it at start-up with CONFIG_BSP_ASSETS.
+
+set(BSP_ASSETS_PACKER "${CMAKE_CURRENT_LIST_DIR}/../tools/pack_assets.py" CACHE INTERNAL "")
+
+function(bsp_add_assets)
+    cmake_parse_arguments(arg "RLE;FLASH_IN_PROJECT" "PARTITION" "FILES" ${ARGN})
+    if(NOT arg_PARTITION)
+        message(FATAL_ERROR "bsp_add_assets() needs the PARTITION label")
+    endif()
+    if(NOT CONFIG_LV_COLOR_DEPTH_16)
+        message(FATAL_ERROR "bsp_add_assets() converts images to RGB565, set LV_COLOR_DEPTH to 16")
+    endif()
+
+    set(format_args)
+    if(CONFIG_LV_COLOR_16_SWAP)
+        list(APPEND format_args --swap)
+    endif()
+    if(arg_RLE)
+        if(NOT CONFIG_BSP_IMG_RLE)
+            message(FATAL_ERROR "bsp_add_assets(RLE) needs the BSP image decoder, enable BSP_IMG_RLE")
+        endif()
+        list(APPEND format_args --rle)
+    endif()
+
+    partition_table_get_partition_info(size "--partition-name ${arg_PARTITION}" "size")
+    partition_table_get_partition_info(offset "--partition-name ${arg_PARTITION}" "offset")
+    if(NOT "${size}" OR NOT "${offset}")
+        message(FATAL_ERROR "bsp_add_assets(): no partition \"${arg_PARTITION}\" in the partition table")
+    endif()
+
+    idf_build_get_property(build_dir BUILD_DIR)
+    idf_build_get_property(python PYTHON)
+    set(image_file "${build_dir}/${arg_PARTITION}.bin")
+    set(files)
+    foreach(file ${arg_FILES})
+        get_filename_component(file_path "${file}" ABSOLUTE)
+        list(APPEND files "${file_path}")
+    endforeach()
+
+    add_custom_command(
+        OUTPUT "${image_file}"
+        COMMAND ${python} "${BSP_ASSETS_PACKER}" ${format_args} --size ${size} -o "${image_file}" ${files}
+        DEPENDS ${files} "${BSP_ASSETS_PACKER}" "${BSP_IMAGES_CONVERTER}"
+        COMMENT "Packing assets into ${arg_PARTITION}.bin"
+        VERBATIM)
+    add_custom_target(${arg_PARTITION}_bin ALL DEPENDS "${image_file}")
+
+    # Same flash targets as spiffs_create_partition_image()
+    idf_component_get_property(main_args esptool_py FLASH_ARGS)
+    idf_component_get_property(sub_args esptool_py FLASH_SUB_ARGS)
+    esptool_py_flash_target(${arg_PARTITION}-flash "${main_args}" "${sub_args}" ALWAYS_PLAINTEXT)
+    esptool_py_flash_to_partition(${arg_PARTITION}-flash "${arg_PARTITION}" "${image_file}")
+    add_dependencies(${arg_PARTITION}-flash ${arg_PARTITION}_bin)
+    if(arg_FLASH_IN_PROJECT)
+        esptool_py_flash_to_partition(flash "${arg_PARTITION}" "${image_file}")
+        add_dependencies(flash ${arg_PARTITION}_bin)
+    endif()
+endfunction()
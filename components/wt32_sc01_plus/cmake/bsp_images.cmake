@@ -0,0 +1,58 @@
+# Build-time conversion of PNG images into LVGL image descriptors
+#
+#   bsp_add_images(IMAGES <png>... [ALIGN <bytes>] [RLE | SPLASH] [SUFFIX <suffix>])
+#
+# Call it after idf_component_register(). Every PNG becomes an lv_img_dsc_t named after the file
+# plus SUFFIX, converted for the LVGL color format of the project (RGB565, LV_COLOR_16_SWAP byte
+# order) and placed in flash. RLE images are decoded by the BSP (CONFIG_BSP_IMG_RLE). The generated
+# sources live in the build directory and follow changes of the PNG files, the converter and the
+# LVGL color configuration.
+# With SPLASH every PNG becomes a bsp_display_splash_t instead, blended onto
+# CONFIG_BSP_DISPLAY_SPLASH_COLOR, to be registered with bsp_display_set_splash()
+# (CONFIG_BSP_DISPLAY_SPLASH).
+
+set(BSP_IMAGES_CONVERTER "${CMAKE_CURRENT_LIST_DIR}/../tools/png2lvgl.py" CACHE INTERNAL "")
+
+function(bsp_add_images)
+    cmake_parse_arguments(arg "RLE;SPLASH" "ALIGN;SUFFIX" "IMAGES" ${ARGN})
+    if(NOT arg_ALIGN)
+        # Word aligned, as required for DMA and 32-bit copies
+        set(arg_ALIGN 4)
+    endif()
+    if(NOT CONFIG_LV_COLOR_DEPTH_16)
+        message(FATAL_ERROR "bsp_add_images() converts to RGB565, set LV_COLOR_DEPTH to 16")
+    endif()
+    set(format_args)
+    if(CONFIG_LV_COLOR_16_SWAP)
+        list(APPEND format_args --swap)
+    endif()
+    if(arg_RLE)
+        if(NOT CONFIG_BSP_IMG_RLE)
+            message(FATAL_ERROR "bsp_add_images(RLE) needs the BSP image decoder, enable BSP_IMG_RLE")
+        endif()
+        list(APPEND format_args --rle)
+    endif()
+    if(arg_SPLASH)
+        if(NOT CONFIG_BSP_DISPLAY_SPLASH)
+            message(FATAL_ERROR "bsp_add_images(SPLASH) needs the splash frame, enable BSP_DISPLAY_SPLASH")
+        endif()
+        # The splash is sent as it is on the bus, the LVGL byte order does not apply
+        set(format_args --splash --bg ${CONFIG_BSP_DISPLAY_SPLASH_COLOR})
+    endif()
+    idf_build_get_property(python PYTHON)
+
+    foreach(png ${arg_IMAGES})
+        get_filename_component(png_path "${png}" ABSOLUTE)
+        get_filename_component(name "${png}" NAME_WE)
+        set(name "${name}${arg_SUFFIX}")
+        set(out "${CMAKE_CURRENT_BINARY_DIR}/images/${name}.c")
+        add_custom_command(
+            OUTPUT "${out}"
+            COMMAND ${CMAKE_COMMAND} -E make_directory "${CMAKE_CURRENT_BINARY_DIR}/images"
+            COMMAND ${python} "${BSP_IMAGES_CONVERTER}" ${format_args} --align ${arg_ALIGN} -n ${name} -o "${out}" "${png_path}"
+            DEPENDS "${png_path}" "${BSP_IMAGES_CONVERTER}"
+            COMMENT "Converting image ${name}"
+            VERBATIM)
+        target_sources(${COMPONENT_LIB} PRIVATE "${out}")
+    endforeach()
+endfunction()
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stddef.h>
+
+/**************************************************************************************************
+ *
+ * LVGL allocator
+ *
+ * With CONFIG_LV_MEM_CUSTOM the BSP passes this header as LV_MEM_CUSTOM_INCLUDE to LVGL and these
+ * functions as LV_MEM_CUSTOM_ALLOC, LV_MEM_CUSTOM_FREE and LV_MEM_CUSTOM_REALLOC.
+ * Use lv_mem_alloc() and lv_mem_free() in the application, not these functions directly.
+ **************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void *bsp_lv_malloc(size_t size);
+
+void bsp_lv_free(void *ptr);
+
+void *bsp_lv_realloc(void *ptr, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
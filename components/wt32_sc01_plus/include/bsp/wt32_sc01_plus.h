@@ -5,6 +5,8 @@
 #include "driver/gpio.h"
 #include "driver/i2c.h"
 #include "driver/sdspi_host.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
 #include "lvgl.h"
 
 /**************************************************************************************************
@@ -40,6 +42,11 @@
 #define BSP_SD_CLK             (GPIO_NUM_39)
 #define BSP_SD_CS              (GPIO_NUM_41)
 
+/* Audio */
+#define BSP_I2S_LRCK           (GPIO_NUM_35)
+#define BSP_I2S_BCLK           (GPIO_NUM_36)
+#define BSP_I2S_DOUT           (GPIO_NUM_37)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -88,6 +95,9 @@ extern sdmmc_card_t *bsp_sdcard;
 /**
  * @brief Mount microSD card to virtual file system
  *
+ * The SPI clock, transfer size, open file count and allocation unit come from the uSD card menu of
+ * the BSP configuration.
+ *
  * @return
  *      - ESP_OK on success
  *      - ESP_ERR_INVALID_STATE if esp_vfs_fat_sdmmc_mount was already called
@@ -100,6 +110,8 @@ esp_err_t bsp_sdcard_mount(void);
 /**
  * @brief Unmount microSD card from virtual file system
  *
+ * The SPI bus is released too, so the card can be mounted again.
+ *
  * @return
  *      - ESP_OK on success
  *      - ESP_ERR_NOT_FOUND if the partition table does not contain FATFS partition with given label
@@ -110,91 +122,1515 @@ esp_err_t bsp_sdcard_mount(void);
  */
 esp_err_t bsp_sdcard_unmount(void);
 
-/**************************************************************************************************
+/**
+ * @brief Start mounting the microSD card in a background task
  *
- * LCD interface
+ * Card detection and the FAT mount take tens to hundreds of milliseconds, they can run while the
+ * display is brought up. Collect the result with bsp_sdcard_mount_wait().
  *
- * This display has 3.5inch and ST7796 display controller.
- * It features 16-bit colors, 320x480 resolution and capacitive touch controller FT5x06.
+ * @return
+ *      - ESP_OK                Mount started
+ *      - ESP_ERR_INVALID_STATE Mount already started
+ *      - ESP_ERR_NO_MEM        Not enough memory for the task
+ */
+esp_err_t bsp_sdcard_mount_async(void);
+
+/**
+ * @brief Wait for the mount started by bsp_sdcard_mount_async()
  *
- * LVGL is used as graphics library. LVGL is NOT thread safe, therefore the user must take LVGL mutex
- * by calling bsp_display_lock() before calling and LVGL API (lv_...) and then give the mutex with
- * bsp_display_unlock().
+ * @param[in] timeout_ms Timeout in [ms]. 0 will block indefinitely.
+ * @return
+ *      - ESP_ERR_TIMEOUT       Mount still in progress
+ *      - ESP_ERR_INVALID_STATE Mount was not started
+ *      - return value of bsp_sdcard_mount() otherwise
+ */
+esp_err_t bsp_sdcard_mount_wait(uint32_t timeout_ms);
+
+#if CONFIG_BSP_ASSETS || CONFIG_BSP_SD_IMG
+/**
+ * @brief Type of an asset or image file
  *
- * Display's backlight must be enabled explicitly by calling bsp_display_backlight_on()
+ */
+typedef enum {
+    BSP_ASSET_DATA = 0,         /*!< File stored as it is */
+    BSP_ASSET_IMG_RGB565,       /*!< Image in LV_IMG_CF_TRUE_COLOR */
+    BSP_ASSET_IMG_RGB565A8,     /*!< Image in LV_IMG_CF_TRUE_COLOR_ALPHA */
+    BSP_ASSET_IMG_RLE,          /*!< Image in BSP_IMG_CF_RLE */
+} bsp_asset_type_t;
+#endif
+
+#if CONFIG_BSP_SD_IMG
+/**************************************************************************************************
+ *
+ * uSD card images
+ *
+ * Image files written by png2lvgl.py --bin are LVGL image sources when their path starts with the
+ * mount point:
+ * \code{.c}
+ * lv_img_set_src(img, BSP_MOUNT_POINT "/ui/background.bin");
+ * \endcode
+ * The first open reads the file in chunks of CONFIG_BSP_SD_IMG_CHUNK_KB and decodes it into a cache
+ * of CONFIG_BSP_SD_IMG_CACHE_SIZE_KB, later opens are served from the cache. Least recently used
+ * images are dropped when the cache is full, images LVGL has open are kept. An image that does not
+ * fit is read from the card line by line every time LVGL draws it.
+ * bsp_sd_img_prefetch() loads the images of the next screen in the background. The card is read by
+ * one load at a time, an LVGL open does not wait for a prefetch in progress but reads that image line
+ * by line once. A miss reads the card in the LVGL task, and so does the first layout of an image not
+ * prefetched for its header, prefetch the images of a screen before showing it.
  **************************************************************************************************/
-#define BSP_LCD_H_RES              (320)
-#define BSP_LCD_V_RES              (480)
-#define BSP_LCD_PIXEL_CLOCK_HZ     (20 * 1000 * 1000)
+#define BSP_SD_IMG_MAGIC        (0x49505342)    // "BSPI"
+#define BSP_SD_IMG_FLAG_SWAP    (1 << 0)        // Image was converted for LV_COLOR_16_SWAP
+#define BSP_SD_IMG_FLAG_ALPHA   (1 << 1)        // Decoded pixels are RGB565 + A8
+#define BSP_SD_IMG_PATH_MAX     (64)            // Longest path, terminator included
 
 /**
- * @brief Initialize display
+ * @brief Header of an image file, followed by size bytes of data
  *
- * This function initializes SPI, display controller and starts LVGL handling task.
- * LCD backlight must be enabled separately by calling bsp_display_brightness_set()
+ */
+typedef struct {
+    uint32_t magic;             /*!< BSP_SD_IMG_MAGIC */
+    uint16_t width;             /*!< Image width */
+    uint16_t height;            /*!< Image height */
+    uint8_t type;               /*!< bsp_asset_type_t of an image */
+    uint8_t flags;              /*!< BSP_SD_IMG_FLAG_x */
+    uint16_t reserved;
+    uint32_t size;              /*!< Size of the data in [B] */
+} bsp_img_file_header_t;
+
+/**
+ * @brief Image cache counters
  *
- * @return Pointer to LVGL display or NULL when error occured
+ * The hit rate is hits / (hits + misses).
  */
-lv_disp_t *bsp_display_start(void);
+typedef struct {
+    uint32_t hits;              /*!< LVGL opens served from the cache, prefetched images included */
+    uint32_t misses;            /*!< LVGL opens that had to load the image */
+    uint32_t prefetches;        /*!< Images loaded by the prefetch task */
+    uint32_t load_errors;       /*!< Loads failed: missing or invalid file, or no memory */
+    uint32_t evictions;         /*!< Images dropped to make room */
+    uint32_t loads;             /*!< Images loaded, by LVGL opens and prefetches */
+    uint64_t load_us;           /*!< Total time of the loads in [us] */
+    uint32_t load_us_max;       /*!< Longest load in [us] */
+    uint64_t load_bytes;        /*!< Bytes read from the card by the loads */
+    uint32_t cache_bytes;       /*!< Bytes of decoded images in the cache */
+    uint32_t streams;           /*!< LVGL opens read line by line, the image did not fit or a prefetch was loading */
+} bsp_sd_img_stats_t;
 
 /**
- * @brief Take LVGL mutex
+ * @brief Load an image into the cache in the background
  *
- * @param timeout_ms Timeout in [ms]. 0 will block indefinitely.
- * @return true  Mutex was taken
- * @return false Mutex was NOT taken
+ * Returns right away, the image is loaded by the prefetch task. Images already in the cache are not
+ * queued again.
+ *
+ * @param[in] path Image file path, starting with BSP_MOUNT_POINT
+ * @return
+ *      - ESP_OK                Image is cached or queued
+ *      - ESP_ERR_INVALID_ARG   Path is not on the uSD card or too long
+ *      - ESP_ERR_INVALID_STATE Display was not started
+ *      - ESP_ERR_NO_MEM        Prefetch queue is full
  */
-bool bsp_display_lock(uint32_t timeout_ms);
+esp_err_t bsp_sd_img_prefetch(const char *path);
 
 /**
- * @brief Give LVGL mutex
+ * @brief Get image cache counters
+ *
+ * @param[out] stats Counters since start-up or the last bsp_sd_img_reset_stats()
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_INVALID_STATE Display was not started
+ */
+esp_err_t bsp_sd_img_get_stats(bsp_sd_img_stats_t *stats);
+
+/**
+ * @brief Reset the image cache counters, except cache_bytes
  *
  */
-void bsp_display_unlock(void);
+void bsp_sd_img_reset_stats(void);
 
 /**
- * @brief Set display's brightness
+ * @brief Drop all images LVGL does not have open from the cache
  *
- * Brightness is controlled with PWM signal to a pin controling backlight.
+ * Call it e.g. after files on the card were replaced.
+ */
+void bsp_sd_img_cache_drop(void);
+#endif
+
+#if CONFIG_BSP_SD_BENCHMARK
+/**
+ * @brief Result of the uSD card benchmark at one SPI clock
  *
- * @param[in] brightness_percent Brightness in [%]
+ */
+typedef struct {
+    uint32_t freq_khz;          /*!< SPI clock requested in [kHz] */
+    uint32_t card_freq_khz;     /*!< SPI clock the card was run at in [kHz] */
+    float seq_write_mbps;       /*!< Sequential write throughput in [MB/s] */
+    float seq_read_mbps;        /*!< Sequential read throughput in [MB/s] */
+    float rand_write_iops;      /*!< 4 kB random writes per second */
+    float rand_read_iops;       /*!< 4 kB random reads per second */
+} bsp_sdcard_benchmark_result_t;
+
+/**
+ * @brief Measure uSD card throughput for several SPI clocks
+ *
+ * For every clock the card is mounted with bsp_sdcard_mount() settings at that clock. A test file of
+ * CONFIG_BSP_SD_BENCHMARK_FILE_KB is written and read sequentially in CONFIG_BSP_SD_BENCHMARK_IO_KB
+ * transfers, then CONFIG_BSP_SD_BENCHMARK_RANDOM_OPS 4 kB blocks are written and read at random
+ * offsets. Sequential reads are checked against the written data. Results are logged as a table, the
+ * file is removed and the card is left mounted as it was before the call.
+ *
+ * @note Nothing else may use the card while the benchmark runs.
+ *
+ * @param[in]  freq_khz Array of SPI clocks to measure in [kHz]
+ * @param[in]  count    Number of items in freq_khz
+ * @param[out] results  Array of count results, may be NULL when only the log is needed
  * @return
  *      - ESP_OK                On success
  *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_NO_MEM        Not enough memory for the transfer buffer
+ *      - ESP_ERR_INVALID_CRC   Data read back differs from the data written
+ *      - ESP_FAIL              A file operation failed
+ *      - other error codes from bsp_sdcard_mount()
  */
-esp_err_t bsp_display_brightness_set(int brightness_percent);
+esp_err_t bsp_sdcard_benchmark(const uint32_t *freq_khz, size_t count, bsp_sdcard_benchmark_result_t *results);
+#endif
+
+#if CONFIG_BSP_SD_IO
+/**************************************************************************************************
+ *
+ * Asynchronous uSD card I/O
+ *
+ * Requests are copied into a buffer of CONFIG_BSP_SD_IO_BUFFER_KB and done in order by a dedicated
+ * task, so the caller never waits for the card. Appends to the same file are gathered into chunks
+ * of CONFIG_BSP_SD_IO_CHUNK_KB that end at chunk aligned offsets, and written to FATFS as a whole.
+ * Files stay open between requests. Data not synced yet reaches the card within
+ * CONFIG_BSP_SD_IO_SYNC_MS, however busy the queue is.
+ *
+ * Example of logging from an LVGL event callback:
+ * \code{.c}
+ * bsp_sd_io_write(BSP_MOUNT_POINT "/events.log", line, len, NULL, NULL);
+ * \endcode
+ *
+ * Callbacks run in the I/O task. Keep them short and take the display lock before calling LVGL.
+ **************************************************************************************************/
+#define BSP_SD_IO_PATH_MAX      (64)            // Longest path, terminator included
 
 /**
- * @brief Turn on display backlight
+ * @brief Completion callback of a request
  *
- * Display must be already initialized by calling bsp_display_start()
+ * @param[in] result   ESP_OK, or the error of the file operation
+ * @param[in] size     Bytes written or read
+ * @param[in] user_ctx User context of the request
+ */
+typedef void (*bsp_sd_io_cb_t)(esp_err_t result, size_t size, void *user_ctx);
+
+/**
+ * @brief Statistics of the I/O service
+ *
+ */
+typedef struct {
+    uint32_t requests;          /*!< Requests accepted */
+    uint32_t rejected;          /*!< Requests refused because the request buffer was full */
+    uint32_t errors;            /*!< File operations that failed */
+    uint32_t queue_depth;       /*!< Requests waiting for the I/O task */
+    uint32_t queue_depth_max;   /*!< Highest queue_depth */
+    uint32_t queued_bytes;      /*!< Write data waiting in the request buffer */
+    uint32_t queued_bytes_max;  /*!< Highest queued_bytes */
+    uint32_t chunk_writes;      /*!< Writes of staged data to FATFS */
+    uint32_t syncs;             /*!< File syncs */
+    uint64_t bytes_written;     /*!< Bytes written to FATFS */
+    uint64_t bytes_read;        /*!< Bytes read from FATFS */
+    uint32_t completions;       /*!< Requests completed through a callback */
+    uint64_t latency_us_total;  /*!< Sum of the request to callback latencies in [us] */
+    uint32_t latency_us_max;    /*!< Longest request to callback latency in [us] */
+    uint32_t fs_us_max;         /*!< Longest single FATFS write or sync in [us], the stall callers are spared */
+} bsp_sd_io_stats_t;
+
+/**
+ * @brief Start the I/O task
+ *
+ * Requests can be queued before the card is mounted, they fail when the task gets to them before
+ * bsp_sdcard_mount() finished.
  *
  * @return
- *      - ESP_OK                On success
+ *      - ESP_OK                On success, or when already started
+ *      - ESP_ERR_NO_MEM        Not enough memory for the buffers or the task
+ */
+esp_err_t bsp_sd_io_start(void);
+
+/**
+ * @brief Queue an append to a file, created when missing
+ *
+ * The data is copied, the buffer can be reused as soon as the call returns.
+ *
+ * @param[in] path     File path, shorter than BSP_SD_IO_PATH_MAX
+ * @param[in] data     Data to append
+ * @param[in] size     Size of data in [B]
+ * @param[in] cb       Called once the data was written to FATFS, may be NULL
+ * @param[in] user_ctx User context passed to cb
+ * @return
+ *      - ESP_OK                Request queued
  *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_INVALID_SIZE  Data larger than the request buffer can hold
+ *      - ESP_ERR_NO_MEM        Request buffer full, try again later
+ *      - ESP_ERR_INVALID_STATE Service not started
  */
-esp_err_t bsp_display_backlight_on(void);
+esp_err_t bsp_sd_io_write(const char *path, const void *data, size_t size, bsp_sd_io_cb_t cb, void *user_ctx);
 
 /**
- * @brief Turn off display backlight
+ * @brief Queue a read from a file
  *
- * Display must be already initialized by calling bsp_display_start()
+ * Staged appends to the same file are written first, so the read sees them.
  *
+ * @param[in]  path     File path, shorter than BSP_SD_IO_PATH_MAX
+ * @param[in]  offset   Offset in the file in [B]
+ * @param[out] buf      Destination, must stay valid until cb is called
+ * @param[in]  size     Size of buf in [B]
+ * @param[in]  cb       Called with the number of bytes read, which is less than size at the end of the file
+ * @param[in]  user_ctx User context passed to cb
  * @return
- *      - ESP_OK                On success
+ *      - ESP_OK                Request queued
  *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_NO_MEM        Request buffer full, try again later
+ *      - ESP_ERR_INVALID_STATE Service not started
  */
-esp_err_t bsp_display_backlight_off(void);
+esp_err_t bsp_sd_io_read(const char *path, size_t offset, void *buf, size_t size, bsp_sd_io_cb_t cb,
+                         void *user_ctx);
 
 /**
- * @brief Rotate screen
+ * @brief Queue the truncation of a file to zero length, created when missing
  *
- * Display must be already initialized by calling bsp_display_start()
+ * Appends queued before are written first and then dropped with the rest of the content, appends
+ * queued after start the file anew.
  *
- * @param[in] disp Pointer to LVGL display
- * @param[in] rotation Angle of the display rotation
+ * @param[in] path     File path, shorter than BSP_SD_IO_PATH_MAX
+ * @param[in] cb       Called when done, may be NULL
+ * @param[in] user_ctx User context passed to cb
+ * @return
+ *      - ESP_OK                Request queued
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_NO_MEM        Request buffer full, try again later
+ *      - ESP_ERR_INVALID_STATE Service not started
  */
-void bsp_display_rotate(lv_disp_t *disp, lv_disp_rot_t rotation);
+esp_err_t bsp_sd_io_truncate(const char *path, bsp_sd_io_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Queue a flush of everything queued before
+ *
+ * Staged data is written and all files are closed, which syncs them. The card can be unmounted once
+ * cb was called.
+ *
+ * @param[in] cb       Called when done, may be NULL
+ * @param[in] user_ctx User context passed to cb
+ * @return
+ *      - ESP_OK                Request queued
+ *      - ESP_ERR_NO_MEM        Request buffer full, try again later
+ *      - ESP_ERR_INVALID_STATE Service not started
+ */
+esp_err_t bsp_sd_io_flush(bsp_sd_io_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Get the statistics of the I/O service
+ *
+ * @param[out] stats Statistics
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   stats is NULL
+ *      - ESP_ERR_INVALID_STATE Service not started
+ */
+esp_err_t bsp_sd_io_get_stats(bsp_sd_io_stats_t *stats);
+
+/**
+ * @brief Reset the counters and maximums of the I/O service, current levels are kept
+ */
+void bsp_sd_io_reset_stats(void);
+#endif
+
+#if CONFIG_BSP_SD_LOG
+/**************************************************************************************************
+ *
+ * Preallocated data logger
+ *
+ * Records of CONFIG_BSP_SD_LOG_RECORD_SIZE go through a lock-free ring buffer to a writer task,
+ * which packs them into blocks of CONFIG_BSP_SD_LOG_BLOCK_KB:
+ *
+ *      | bsp_sd_log_block_t | record | record | ... | zero padding |
+ *
+ * Blocks are written at block aligned offsets of log files under BSP_MOUNT_POINT ("log00001.bin",
+ * "log00002.bin", ...). Each file is preallocated to CONFIG_BSP_SD_LOG_FILE_MB when it is started, so
+ * writing a block never allocates clusters or changes the directory entry. The clusters are contiguous
+ * only with ESP-IDF 5.2 or later and a card that still has a free run that large. Block sequence numbers
+ * continue across files. At start the logger resumes after the last block whose header and CRC
+ * are intact, so a power cut loses no block that was written before it. Read the files with
+ * tools/sd_log_dump.py.
+ **************************************************************************************************/
+#define BSP_SD_LOG_MAGIC        (0x4C505342)    // "BSPL"
+
+/**
+ * @brief Header of a log block
+ *
+ */
+typedef struct {
+    uint32_t magic;             /*!< BSP_SD_LOG_MAGIC */
+    uint32_t seq;               /*!< Block sequence number, +1 for every block of the log */
+    uint16_t record_size;       /*!< Size of one record in [B] */
+    uint16_t records;           /*!< Records in the block, fewer than fit when it was written for a sync */
+    uint32_t crc32;             /*!< CRC-32 of the records */
+} bsp_sd_log_block_t;
+
+/**
+ * @brief Statistics of the logger
+ *
+ */
+typedef struct {
+    uint32_t records;           /*!< Records accepted by bsp_sd_log_write() */
+    uint32_t dropped;           /*!< Records refused because the ring buffer was full */
+    uint32_t records_written;   /*!< Records in blocks written to the card */
+    uint32_t blocks;            /*!< Blocks written */
+    uint32_t partial_blocks;    /*!< Blocks written before they were full, for a sync */
+    uint32_t syncs;             /*!< File syncs */
+    uint32_t files;             /*!< Log files started, not counting the resumed one */
+    uint32_t errors;            /*!< File operations that failed */
+    uint32_t ring_max;          /*!< Most records seen in the ring buffer */
+    uint32_t block_us_max;      /*!< Longest block write in [us] */
+    uint32_t sync_us_max;       /*!< Longest sync in [us] */
+    uint32_t seq;               /*!< Sequence number of the next block */
+} bsp_sd_log_stats_t;
+
+/**
+ * @brief Start the logger on the mounted uSD card
+ *
+ * The newest log file is searched for the last intact block, then the writer task is started.
+ * A new log file is created and preallocated when there is none or the newest one is full.
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_STATE Already started, or the card is not mounted
+ *      - ESP_ERR_NO_MEM        Not enough memory for the buffers or the task
+ *      - ESP_FAIL              The log file could not be opened or preallocated
+ */
+esp_err_t bsp_sd_log_start(void);
+
+/**
+ * @brief Write the records left in the ring buffer, sync and stop the logger
+ *
+ * Call it before bsp_sdcard_unmount().
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_STATE Not started
+ */
+esp_err_t bsp_sd_log_stop(void);
+
+/**
+ * @brief Log one record
+ *
+ * Lock-free and never blocks, any number of tasks may log at the same time. The record is copied.
+ *
+ * @param[in] record CONFIG_BSP_SD_LOG_RECORD_SIZE bytes to log
+ * @return
+ *      - ESP_OK                Record queued
+ *      - ESP_ERR_NO_MEM        Ring buffer full, the record was dropped
+ *      - ESP_ERR_INVALID_STATE Logger not started
+ */
+esp_err_t bsp_sd_log_write(const void *record);
+
+/**
+ * @brief Ask the writer task to write the current block and sync now, without waiting for it
+ */
+void bsp_sd_log_flush(void);
+
+/**
+ * @brief Get the statistics of the logger
+ *
+ * @param[out] stats Statistics
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   stats is NULL
+ */
+esp_err_t bsp_sd_log_get_stats(bsp_sd_log_stats_t *stats);
+
+#if CONFIG_BSP_SD_LOG_BENCHMARK
+/**
+ * @brief Result of the logger benchmark
+ *
+ */
+typedef struct {
+    uint32_t records;           /*!< Records written by each method */
+    float fwrite_mbps;          /*!< fwrite() throughput, syncs included, in [MB/s] */
+    uint32_t fwrite_us_avg;     /*!< Average fwrite() call in [us] */
+    uint32_t fwrite_us_max;     /*!< Longest fwrite() or fsync() call in [us] */
+    float log_mbps;             /*!< Logger throughput until the last record was on the card in [MB/s] */
+    uint32_t log_us_avg;        /*!< Average bsp_sd_log_write() call in [us] */
+    uint32_t log_us_max;        /*!< Longest bsp_sd_log_write() call in [us] */
+    uint32_t log_retries;       /*!< bsp_sd_log_write() calls that found the ring buffer full */
+} bsp_sd_log_bench_result_t;
+
+/**
+ * @brief Compare the logger with plain fwrite() to a growing file
+ *
+ * CONFIG_BSP_SD_LOG_BENCHMARK_RECORDS records are written with fwrite() and fsync() every
+ * CONFIG_BSP_SD_LOG_SYNC_MS to a scratch file, then logged with bsp_sd_log_write() as fast as the
+ * ring buffer takes them. Call latencies and throughputs are logged. The logger is started for the
+ * benchmark when it is not running, and its records stay in the log.
+ *
+ * @param[out] result Result, may be NULL when only the log is needed
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_NO_MEM        Not enough memory
+ *      - ESP_FAIL              A file operation failed
+ *      - other error codes from bsp_sd_log_start()
+ */
+esp_err_t bsp_sd_log_benchmark(bsp_sd_log_bench_result_t *result);
+#endif
+#endif
+
+#if CONFIG_BSP_AUDIO
+/**************************************************************************************************
+ *
+ * Audio playback
+ *
+ * The I2S amplifier plays 16 bit stereo at CONFIG_BSP_AUDIO_SAMPLE_RATE, or at the rate of the WAV
+ * file being played. A reader task fills two buffers from the file while the I2S task copies the
+ * other one to the DMA, so card and display stalls shorter than one buffer are not heard:
+ * \code{.c}
+ * bsp_audio_init();
+ * bsp_audio_play(BSP_MOUNT_POINT "/music.wav", true);
+ * \endcode
+ *
+ * WAV files hold 16 bit PCM, mono or stereo. Files without a RIFF header are played as raw 16 bit
+ * little endian stereo at CONFIG_BSP_AUDIO_SAMPLE_RATE. Silence is sent while nothing plays.
+ **************************************************************************************************/
+#define BSP_AUDIO_PATH_MAX      (64)            // Longest path, terminator included
+
+/**
+ * @brief Statistics of the playback engine
+ *
+ */
+typedef struct {
+    uint32_t streams;           /*!< Files played to the end */
+    uint32_t errors;            /*!< Files that could not be opened, parsed or read */
+    uint32_t underruns;         /*!< DMA buffers the I2S sent before the I2S task refilled them */
+    uint32_t starved;           /*!< Silence inserted during playback because the reader was late */
+    uint32_t rate_changes;      /*!< I2S clock changes for a WAV file */
+    uint64_t bytes_played;      /*!< PCM bytes of files written to the DMA */
+    uint32_t dma_size;          /*!< Size of the DMA buffer in [B] */
+    uint32_t dma_fill;          /*!< Bytes written to the DMA buffer and not sent yet, estimated */
+    uint32_t dma_fill_min;      /*!< Lowest dma_fill seen during playback */
+    uint32_t read_buffers;      /*!< Read buffers filled and waiting for the I2S task, 0 to 2 */
+    uint32_t read_buffers_min;  /*!< Lowest read_buffers seen during playback */
+    uint32_t read_us_max;       /*!< Longest read of one buffer from the file in [us] */
+} bsp_audio_stats_t;
+
+/**
+ * @brief Set up the I2S peripheral and start the playback tasks
+ *
+ * Uses CONFIG_BSP_I2S_NUM and the DMA buffer sizes of the Audio menu of the BSP configuration.
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_STATE Already initialized
+ *      - ESP_ERR_NO_MEM        Not enough memory for the buffers or the tasks
+ *      - other error codes from the I2S driver
+ */
+esp_err_t bsp_audio_init(void);
+
+/**
+ * @brief Stop playback, stop the tasks and free the I2S peripheral
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_STATE Not initialized
+ */
+esp_err_t bsp_audio_deinit(void);
+
+/**
+ * @brief Start playing a file, stopping the one playing
+ *
+ * Returns at once, the file is opened by the reader task. Errors of the file are counted in the
+ * statistics and end the playback.
+ *
+ * @param[in] path WAV or raw PCM file, usually under BSP_MOUNT_POINT
+ * @param[in] loop Play the file again from its start when it ends
+ * @return
+ *      - ESP_OK                Playback queued
+ *      - ESP_ERR_INVALID_ARG   path is NULL or longer than BSP_AUDIO_PATH_MAX
+ *      - ESP_ERR_INVALID_STATE Not initialized
+ */
+esp_err_t bsp_audio_play(const char *path, bool loop);
+
+/**
+ * @brief Stop playing
+ *
+ * Buffered data of the file is dropped, the DMA buffer plays out as usual.
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_STATE Not initialized
+ */
+esp_err_t bsp_audio_stop(void);
+
+/**
+ * @brief Check whether a file is playing
+ *
+ * @return true from bsp_audio_play() until the file ended, failed or was stopped
+ */
+bool bsp_audio_is_playing(void);
+
+/**
+ * @brief Get the statistics of the playback engine
+ *
+ * @param[out] stats Statistics
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   stats is NULL
+ */
+esp_err_t bsp_audio_get_stats(bsp_audio_stats_t *stats);
+
+/**
+ * @brief Reset the counters and the low and high marks of the statistics
+ */
+void bsp_audio_reset_stats(void);
+
+#if CONFIG_BSP_AUDIO_SFX
+/**************************************************************************************************
+ *
+ * Sound effects
+ *
+ * Effects are loaded once into a cache of CONFIG_BSP_AUDIO_SFX_CACHE_KB in internal RAM. The I2S
+ * task mixes up to CONFIG_BSP_AUDIO_SFX_VOICES of them over the music or the silence, in 16 bit
+ * fixed point with saturation. Triggers are lock-free and never touch a file, so they can be called
+ * from LVGL event callbacks:
+ * \code{.c}
+ * static bsp_audio_sfx_t click;
+ * bsp_audio_sfx_load(BSP_MOUNT_POINT "/click.wav", &click);
+ *
+ * static void btn_cb(lv_event_t *e)
+ * {
+ *     bsp_audio_sfx_play(click, 100);
+ * }
+ * \endcode
+ *
+ * An effect is mixed into the DMA buffer written after its trigger. It is heard once the
+ * CONFIG_BSP_AUDIO_DMA_DESC_NUM buffers queued before it are played.
+ **************************************************************************************************/
+#define BSP_AUDIO_SFX_NONE      (-1)            // Handle of no effect, bsp_audio_sfx_play() refuses it
+
+/**
+ * @brief Handle of a loaded effect
+ */
+typedef int bsp_audio_sfx_t;
+
+/**
+ * @brief Statistics of the effect mixer
+ *
+ */
+typedef struct {
+    uint32_t effects;           /*!< Effects in the cache */
+    uint32_t cache_used;        /*!< Bytes of PCM data in the cache */
+    uint32_t cache_hits;        /*!< Loads served by an effect already in the cache */
+    uint32_t triggers;          /*!< Accepted bsp_audio_sfx_play() calls */
+    uint32_t dropped;           /*!< Triggers refused because the trigger queue was full */
+    uint32_t stolen;            /*!< Voices taken over from a playing effect */
+    uint32_t voices_max;        /*!< Most voices playing at once */
+    uint32_t started;           /*!< Effects mixed into the DMA buffer */
+    uint64_t latency_us_total;  /*!< Sum of trigger to output latencies of started effects in [us] */
+    uint32_t latency_us_max;    /*!< Longest trigger to output latency in [us], includes the queued DMA buffer */
+} bsp_audio_sfx_stats_t;
+
+/**
+ * @brief Load an effect from a WAV or raw PCM file into the cache
+ *
+ * The file is read and decoded here, call it at start-up rather than in an event callback. A path
+ * already in the cache returns its effect without reading the file again.
+ *
+ * @param[in]  path    16 bit PCM WAV or raw stereo PCM file
+ * @param[out] ret_sfx Effect handle
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error, or path longer than BSP_AUDIO_PATH_MAX
+ *      - ESP_ERR_NOT_FOUND     The file could not be opened
+ *      - ESP_ERR_NOT_SUPPORTED Not a 16 bit PCM file
+ *      - ESP_ERR_NO_MEM        Cache full, or no internal RAM left
+ *      - ESP_FAIL              Read error
+ */
+esp_err_t bsp_audio_sfx_load(const char *path, bsp_audio_sfx_t *ret_sfx);
+
+/**
+ * @brief Load an effect from a WAV file in memory into the cache
+ *
+ * For effects in the assets partition, see bsp_assets_get_data(). The PCM data is copied.
+ *
+ * @param[in]  name    Name of the effect in the cache, at most BSP_AUDIO_PATH_MAX - 1 characters
+ * @param[in]  data    WAV or raw stereo PCM file
+ * @param[in]  size    Size of data
+ * @param[out] ret_sfx Effect handle
+ * @return
+ *      - return values of bsp_audio_sfx_load()
+ */
+esp_err_t bsp_audio_sfx_load_mem(const char *name, const void *data, size_t size, bsp_audio_sfx_t *ret_sfx);
+
+/**
+ * @brief Play an effect
+ *
+ * Lock-free and never blocks, safe from any task including LVGL callbacks.
+ *
+ * @param[in] sfx    Effect handle
+ * @param[in] volume Volume in [%], 0 - 100
+ * @return
+ *      - ESP_OK                Trigger queued
+ *      - ESP_ERR_INVALID_ARG   No such effect
+ *      - ESP_ERR_NO_MEM        Trigger queue full
+ *      - ESP_ERR_INVALID_STATE Audio not initialized
+ */
+esp_err_t bsp_audio_sfx_play(bsp_audio_sfx_t sfx, int volume);
+
+/**
+ * @brief Get the statistics of the effect mixer
+ *
+ * @param[out] stats Statistics
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   stats is NULL
+ */
+esp_err_t bsp_audio_sfx_get_stats(bsp_audio_sfx_stats_t *stats);
+#endif
+#endif
+
+/**************************************************************************************************
+ *
+ * LCD interface
+ *
+ * This display has 3.5inch and ST7796 display controller.
+ * It features 16-bit colors, 320x480 resolution and capacitive touch controller FT5x06.
+ *
+ * LVGL is used as graphics library. LVGL is NOT thread safe, therefore the user must take LVGL mutex
+ * by calling bsp_display_lock() before calling and LVGL API (lv_...) and then give the mutex with
+ * bsp_display_unlock().
+ *
+ * Display's backlight must be enabled explicitly by calling bsp_display_backlight_on()
+ *
+ * With CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR the draw buffers hold a full frame in PSRAM and every flush
+ * starts on the TE (frame sync) edge of the panel. LVGL runs in full-refresh or direct mode.
+ **************************************************************************************************/
+#define BSP_LCD_H_RES              (320)
+#define BSP_LCD_V_RES              (480)
+#define BSP_LCD_PIXEL_CLOCK_HZ     (CONFIG_BSP_LCD_PIXEL_CLOCK_KHZ * 1000)
+
+/**
+ * @brief BSP display configuration structure
+ *
+ */
+typedef struct {
+    uint32_t pclk_hz;           /*!< i80 pixel (WR) clock in [Hz] */
+    size_t max_transfer_bytes;  /*!< Maximum size of one color transfer in [B] */
+} bsp_display_config_t;
+
+/**
+ * @brief Create new display panel
+ *
+ * Initializes the i80 bus, panel IO and ST7796 panel without LVGL. The panel is turned on,
+ * but the backlight stays off.
+ *
+ * @note This function can be used for displaying content without LVGL. If LVGL is used, call bsp_display_start() instead.
+ *
+ * @param[in]  config    Display configuration, NULL for default configuration (Kconfig pixel clock)
+ * @param[out] ret_panel esp_lcd panel handle
+ * @param[out] ret_io    esp_lcd IO handle
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - other error codes from LEDC, i80 or esp_lcd drivers
+ */
+esp_err_t bsp_display_new(const bsp_display_config_t *config, esp_lcd_panel_handle_t *ret_panel, esp_lcd_panel_io_handle_t *ret_io);
+
+/**
+ * @brief Delete display panel created by bsp_display_new()
+ *
+ * Deletes the panel, panel IO and the i80 bus.
+ *
+ * @param[in] panel esp_lcd panel handle
+ * @param[in] io    esp_lcd IO handle
+ * @return
+ *      - ESP_OK                On success
+ *      - other error codes from esp_lcd drivers
+ */
+esp_err_t bsp_display_del(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io);
+
+/**
+ * @brief Initialize display
+ *
+ * This function initializes SPI, display controller and starts LVGL handling task.
+ * LCD backlight must be enabled separately by calling bsp_display_brightness_set()
+ *
+ * With CONFIG_BSP_DISPLAY_SPLASH the splash is sent to the panel before LVGL starts and the backlight
+ * is set to CONFIG_BSP_DISPLAY_SPLASH_BRIGHTNESS. With CONFIG_BSP_TOUCH_PARALLEL_INIT the touch
+ * controller is brought up in another task once the panel is out of reset, bsp_i2c_init() must be
+ * called before.
+ *
+ * @return Pointer to LVGL display or NULL when error occured
+ */
+lv_disp_t *bsp_display_start(void);
+
+#if CONFIG_BSP_DISPLAY_SPLASH
+/**
+ * @brief Splash image, run-length encoded RGB565
+ *
+ * The image is stored as pairs of 16-bit words {run length, color}, row after row in the native
+ * portrait orientation of the panel (BSP_LCD_H_RES x BSP_LCD_V_RES). Colors are in the byte order
+ * sent on the bus, the same as LVGL uses with LV_COLOR_16_SWAP.
+ */
+typedef struct {
+    uint16_t bg_color;          /*!< Color of the rest of the screen */
+    uint16_t width;             /*!< Image width in [px], 0 for the background only */
+    uint16_t height;            /*!< Image height in [px] */
+    const uint16_t *rle;        /*!< Runs of the image */
+    size_t rle_words;           /*!< Number of 16-bit words in rle */
+} bsp_display_splash_t;
+
+/**
+ * @brief Register the splash sent to the panel by bsp_display_start() before the backlight is on
+ *
+ * Without a registered splash the screen is filled with CONFIG_BSP_DISPLAY_SPLASH_COLOR.
+ * bsp_add_images(IMAGES <png> SPLASH) converts a PNG into a bsp_display_splash_t at build time.
+ *
+ * @param[in] splash Splash centered on the screen, must stay valid until bsp_display_start() returns
+ */
+void bsp_display_set_splash(const bsp_display_splash_t *splash);
+#endif
+
+/**
+ * @brief Take LVGL mutex
+ *
+ * @param timeout_ms Timeout in [ms]. 0 will block indefinitely.
+ * @return true  Mutex was taken
+ * @return false Mutex was NOT taken
+ */
+bool bsp_display_lock(uint32_t timeout_ms);
+
+/**
+ * @brief Give LVGL mutex
+ *
+ */
+void bsp_display_unlock(void);
+
+/**
+ * @brief Set display's brightness
+ *
+ * Brightness is controlled with PWM signal to a pin controling backlight.
+ *
+ * @param[in] brightness_percent Brightness in [%]
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_display_brightness_set(int brightness_percent);
+
+/**
+ * @brief Turn on display backlight
+ *
+ * Display must be already initialized by calling bsp_display_start()
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_display_backlight_on(void);
+
+/**
+ * @brief Turn off display backlight
+ *
+ * Display must be already initialized by calling bsp_display_start()
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_display_backlight_off(void);
+
+/**
+ * @brief Rotate screen
+ *
+ * Display must be already initialized by calling bsp_display_start()
+ *
+ * With CONFIG_BSP_DISPLAY_HW_ROTATION the memory access order of the panel (MADCTL) and the touch
+ * mapping are changed instead, and LVGL sees an unrotated display with the rotated resolution.
+ * Rendered areas then go to the panel without the LVGL software rotation copy. Values above
+ * LV_DISP_ROT_270 are rejected and leave the display unchanged.
+ *
+ * @param[in] disp Pointer to LVGL display
+ * @param[in] rotation Angle of the display rotation
+ */
+void bsp_display_rotate(lv_disp_t *disp, lv_disp_rot_t rotation);
+
+/**
+ * @brief Display flush statistics
+ *
+ * Area counters are only updated with CONFIG_BSP_DISPLAY_FLUSH_COALESCE, band counters only with
+ * CONFIG_BSP_DISPLAY_FLUSH_PIPELINE. Average queue occupancy is band_occupancy_sum / bands.
+ */
+typedef struct {
+    uint32_t frames;            /*!< Refreshes that flushed at least one area */
+    uint32_t areas_in;          /*!< Invalidated areas before coalescing */
+    uint32_t areas_out;         /*!< Areas left after coalescing, each one opens a new window on the panel */
+    uint32_t transfers;         /*!< Color transfers issued on the i80 bus */
+    uint64_t pixel_bytes;       /*!< Color bytes sent to the panel */
+    uint64_t overdraw_bytes;    /*!< Extra color bytes sent because areas were merged */
+    uint64_t cmd_bytes_saved;   /*!< CASET/RASET/RAMWR bytes avoided because areas were merged */
+    uint32_t bands;             /*!< Bands queued to the flush task */
+    uint32_t band_buffers;      /*!< Band buffers in the pool, 0 when the pipeline is not running */
+    uint64_t band_occupancy_sum;/*!< Sum of the bands queued or on the bus, sampled when a band is queued */
+    uint32_t band_occupancy_max;/*!< Most bands queued or on the bus at once */
+    uint32_t render_stalls;     /*!< Bands after which LVGL waited for a free buffer */
+    uint64_t render_stall_us;   /*!< Time LVGL spent waiting for a free buffer */
+    uint32_t bus_starved;       /*!< Times the bus ran out of bands in the middle of a frame */
+    uint64_t bus_idle_us;       /*!< Bus idle time in the middle of frames */
+} bsp_display_flush_stats_t;
+
+/**
+ * @brief Get display flush statistics
+ *
+ * Transactions saved by coalescing are areas_in - areas_out.
+ *
+ * @param[out] stats Statistics since start or the last bsp_display_flush_reset_stats()
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_INVALID_STATE Display was not started
+ */
+esp_err_t bsp_display_flush_get_stats(bsp_display_flush_stats_t *stats);
+
+/**
+ * @brief Reset display flush statistics
+ *
+ */
+void bsp_display_flush_reset_stats(void);
+
+#if CONFIG_BSP_DISPLAY_LATENCY
+/**
+ * @brief Touch-to-photon latency statistics
+ *
+ * Latency is measured from the falling edge of the touch INT line to the end of the last color
+ * transfer of the first refresh after LVGL processed the press. Percentiles are upper bounds of 1 ms buckets.
+ */
+typedef struct {
+    uint32_t samples;       /*!< Touches measured */
+    uint32_t dropped;       /*!< Touches that did not reach the panel within 1 s */
+    uint32_t min_us;        /*!< Shortest latency */
+    uint32_t avg_us;        /*!< Average latency */
+    uint32_t p50_us;        /*!< Median latency */
+    uint32_t p95_us;        /*!< 95th percentile of the latency */
+    uint32_t p99_us;        /*!< 99th percentile of the latency */
+    uint32_t max_us;        /*!< Longest latency */
+    uint32_t input_avg_us;  /*!< Average part of the latency until LVGL processed the press */
+} bsp_display_latency_stats_t;
+
+/**
+ * @brief Get touch-to-photon latency statistics
+ *
+ * @param[out] stats Statistics since start or the last bsp_display_latency_reset()
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_display_latency_get_stats(bsp_display_latency_stats_t *stats);
+
+/**
+ * @brief Reset touch-to-photon latency statistics
+ *
+ */
+void bsp_display_latency_reset(void);
+#endif
+
+#if CONFIG_BSP_DISPLAY_TIMING
+/**
+ * @brief Summary of a frame timing histogram
+ *
+ * Percentiles are upper bounds of the histogram bucket, accurate to 25 %.
+ */
+typedef struct {
+    uint32_t count;     /*!< Recorded values */
+    uint32_t min;       /*!< Smallest value */
+    uint32_t avg;       /*!< Average value */
+    uint32_t p50;       /*!< Median */
+    uint32_t p95;       /*!< 95th percentile */
+    uint32_t p99;       /*!< 99th percentile */
+    uint32_t max;       /*!< Largest value */
+} bsp_display_timing_hist_t;
+
+/**
+ * @brief Per-stage frame timing
+ *
+ * Values are per refresh that flushed at least one area, unless noted otherwise.
+ */
+typedef struct {
+    uint32_t frames;                            /*!< Refreshes that flushed at least one area */
+    bsp_display_timing_hist_t render_us;        /*!< Refresh time without flush submit and DMA wait */
+    bsp_display_timing_hist_t flush_submit_us;  /*!< Per flush: time in the flush callback, TE wait included */
+    bsp_display_timing_hist_t flush_done_us;    /*!< Per flush: from the flush callback to the last transfer done */
+    bsp_display_timing_hist_t dma_wait_us;      /*!< Time LVGL waited for the panel to release a draw buffer */
+    bsp_display_timing_hist_t bus_bytes;        /*!< Color bytes sent to the panel */
+    bsp_display_timing_hist_t lock_wait_us;     /*!< Per bsp_display_lock(): time until the lock was taken */
+    bsp_display_timing_hist_t lock_hold_us;     /*!< Per bsp_display_lock(): time until bsp_display_unlock() */
+    bsp_display_timing_hist_t period_us;        /*!< Time between starts of back-to-back refreshes */
+    bsp_display_timing_hist_t jitter_us;        /*!< Difference of the period to the refresh timer period */
+} bsp_display_timing_stats_t;
+
+/**
+ * @brief Get per-stage frame timing
+ *
+ * Does not take the display lock, so it may be called from any task, including esp_timer callbacks.
+ *
+ * @param[out] stats Statistics since start or the last bsp_display_timing_reset()
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_display_timing_get_stats(bsp_display_timing_stats_t *stats);
+
+/**
+ * @brief Reset per-stage frame timing
+ *
+ */
+void bsp_display_timing_reset(void);
+#endif
+
+#if CONFIG_BSP_DISPLAY_DRAW_ACCEL
+/**
+ * @brief Verify the BSP blend kernels against the LVGL C reference
+ *
+ * Random fills, copies and masked blends with every row alignment are drawn by lv_draw_sw_blend_basic()
+ * and by the active BSP kernels (PIE or scalar), the results must be identical.
+ * It runs at start-up with CONFIG_BSP_DISPLAY_DRAW_SELFTEST.
+ *
+ * @return
+ *      - ESP_OK                Kernels match the reference
+ *      - ESP_FAIL              Mismatch found, details are logged
+ *      - ESP_ERR_NO_MEM        Not enough memory for the test buffers
+ *      - ESP_ERR_INVALID_STATE Display was not started
+ */
+esp_err_t bsp_display_draw_selftest(void);
+#endif
+
+#if CONFIG_BSP_DISPLAY_DUAL_CORE
+/**
+ * @brief Switch rendering on both cores on or off
+ *
+ * Large blends are split between the LVGL task and the render helper on the other core.
+ * It is on after bsp_display_start(), switching it off gives single-core numbers for comparison.
+ *
+ * @param[in] enable true to render on both cores
+ */
+void bsp_display_dual_core_enable(bool enable);
+
+/**
+ * @brief Check if rendering on both cores is on
+ *
+ * @return true when large blends are split between both cores
+ */
+bool bsp_display_dual_core_is_enabled(void);
+
+/**
+ * @brief Compare rendering on one and on both cores
+ *
+ * The active screen is refreshed the given number of times rendering on one core, and again on
+ * both cores. The average time of a full screen refresh, flush included, is logged and returned.
+ *
+ * @param[in]  disp      Pointer to LVGL display
+ * @param[in]  frames    Refreshes per run
+ * @param[out] single_us Average refresh time on one core, may be NULL
+ * @param[out] dual_us   Average refresh time on both cores, may be NULL
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_INVALID_STATE Render helper is not running
+ */
+esp_err_t bsp_display_dual_core_compare(lv_disp_t *disp, uint32_t frames, uint32_t *single_us, uint32_t *dual_us);
+#endif
+
+#if CONFIG_BSP_DISPLAY_BENCHMARK
+/**
+ * @brief Result of one flush throughput measurement
+ *
+ */
+typedef struct {
+    uint32_t pclk_hz;           /*!< Pixel clock the panel was driven with */
+    uint32_t frame_time_us;     /*!< Average time to send one full frame in [us] */
+    float throughput_mbps;      /*!< Average bus throughput in [MB/s] */
+} bsp_display_benchmark_result_t;
+
+/**
+ * @brief Measure flush throughput of the i80 bus for several pixel clocks
+ *
+ * For every pixel clock the panel is created with bsp_display_new(), known patterns (solid, color bars
+ * and a 1-pixel checkerboard that toggles every data line) are pushed with esp_lcd_panel_draw_bitmap
+ * for CONFIG_BSP_DISPLAY_BENCHMARK_FRAMES full frames and the panel is deleted again.
+ * Results are logged as a table. Watch the screen for artifacts on the checkerboard to find the fastest
+ * stable clock of a unit.
+ *
+ * @note Must be called before bsp_display_start(), it uses the i80 bus exclusively.
+ *
+ * @param[in]  pclk_hz Array of pixel clocks to measure in [Hz]
+ * @param[in]  count   Number of items in pclk_hz
+ * @param[out] results Array of count results, may be NULL when only the log is needed
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_NO_MEM        Not enough memory for the pattern buffer
+ *      - ESP_ERR_TIMEOUT       Transfers did not finish in time
+ *      - other error codes from esp_lcd drivers
+ */
+esp_err_t bsp_display_benchmark(const uint32_t *pclk_hz, size_t count, bsp_display_benchmark_result_t *results);
+#endif
+
+#if CONFIG_BSP_BOOT_TIMING
+/**************************************************************************************************
+ *
+ * Boot phase timing
+ *
+ **************************************************************************************************/
+#define BSP_BOOT_PHASES_MAX         (16)
+
+/**
+ * @brief Boot phase, times since the start of the application
+ */
+typedef struct {
+    const char *name;           /*!< Phase name */
+    uint32_t start_us;          /*!< Start of the phase */
+    uint32_t end_us;            /*!< End of the phase, 0 while it is running */
+} bsp_boot_phase_t;
+
+/**
+ * @brief Start a boot phase
+ *
+ * Phases may overlap and may run in other tasks. Phases over BSP_BOOT_PHASES_MAX are not recorded.
+ *
+ * @param[in] name Phase name, must stay valid
+ * @return Phase handle for bsp_boot_phase_end(), -1 when the table is full
+ */
+int bsp_boot_phase_begin(const char *name);
+
+/**
+ * @brief End a boot phase
+ *
+ * @param[in] phase Handle returned by bsp_boot_phase_begin()
+ */
+void bsp_boot_phase_end(int phase);
+
+/**
+ * @brief Get the recorded boot phases
+ *
+ * @param[out] phases Array of BSP_BOOT_PHASES_MAX phases
+ * @return Number of phases
+ */
+size_t bsp_boot_get_phases(bsp_boot_phase_t *phases);
+
+/**
+ * @brief Log the recorded boot phases with their start, end and duration
+ *
+ */
+void bsp_boot_report(void);
+#endif
+
+#if CONFIG_BSP_HEAP_TELEMETRY
+/**************************************************************************************************
+ *
+ * Heap telemetry
+ *
+ * The heaps are sampled every CONFIG_BSP_HEAP_TELEMETRY_PERIOD_MS in the esp_timer task after
+ * bsp_heap_telemetry_start(). Fragmentation is 100 - largest free block * 100 / free size, the same
+ * measure as lv_mem_monitor() uses.
+ **************************************************************************************************/
+
+/**
+ * @brief Heap regions sampled by the telemetry
+ *
+ */
+typedef enum {
+    BSP_HEAP_INTERNAL,      /*!< MALLOC_CAP_INTERNAL */
+    BSP_HEAP_DMA,           /*!< MALLOC_CAP_DMA, needed by draw buffers and bus transfers */
+    BSP_HEAP_SPIRAM,        /*!< MALLOC_CAP_SPIRAM */
+    BSP_HEAP_REGION_MAX,
+} bsp_heap_region_t;
+
+/**
+ * @brief State of one heap region
+ *
+ */
+typedef struct {
+    size_t total;               /*!< Size of the region */
+    size_t free;                /*!< Free bytes in the last sample */
+    size_t largest_block;       /*!< Largest free block in the last sample */
+    size_t min_free;            /*!< Least free bytes since boot */
+    size_t min_largest_block;   /*!< Smallest largest free block of all samples */
+    uint32_t free_blocks;       /*!< Free blocks in the last sample */
+    uint8_t frag_pct;           /*!< Fragmentation in the last sample */
+} bsp_heap_region_stats_t;
+
+/**
+ * @brief LVGL allocations, zero without CONFIG_BSP_HEAP_TELEMETRY_LVGL
+ *
+ */
+typedef struct {
+    uint32_t blocks;            /*!< Allocations in use */
+    uint32_t allocs;            /*!< Allocations since start */
+    uint32_t failures;          /*!< Allocations that returned NULL */
+    size_t used;                /*!< Bytes in use */
+    size_t peak;                /*!< Most bytes in use at any time */
+    uint8_t frag_pct;           /*!< Fragmentation of the heap LVGL allocates from */
+} bsp_heap_lvgl_stats_t;
+
+/**
+ * @brief Heap telemetry
+ *
+ */
+typedef struct {
+    uint32_t samples;                                   /*!< Samples taken */
+    bsp_heap_region_stats_t region[BSP_HEAP_REGION_MAX];
+    bsp_heap_lvgl_stats_t lvgl;
+} bsp_heap_stats_t;
+
+/**
+ * @brief Start sampling the heaps in the background
+ *
+ * Samples are logged every CONFIG_BSP_HEAP_TELEMETRY_LOG_PERIOD_S.
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_STATE Already started
+ *      - other error codes from esp_timer
+ */
+esp_err_t bsp_heap_telemetry_start(void);
+
+/**
+ * @brief Sample the heaps now and get the telemetry
+ *
+ * Works also before bsp_heap_telemetry_start().
+ *
+ * @param[out] stats Telemetry
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_heap_get_stats(bsp_heap_stats_t *stats);
+#endif
+
+#if CONFIG_BSP_LV_MEM_POOL
+/**************************************************************************************************
+ *
+ * LVGL memory
+ *
+ * With CONFIG_BSP_LV_MEM_POOL LVGL allocations up to 2048 B come from size-class pools, the small
+ * classes in internal RAM and the large ones in PSRAM. See Kconfig for the placement and sizes.
+ **************************************************************************************************/
+#define BSP_LV_MEM_CLASSES  (8)     // 16, 32, 64, ... 2048 B
+
+/**
+ * @brief Usage of one size class
+ *
+ */
+typedef struct {
+    uint32_t size;          /*!< Largest request served by the class */
+    uint32_t blocks;        /*!< Blocks in the pool */
+    uint32_t used;          /*!< Blocks in use */
+    uint32_t peak;          /*!< Most blocks in use at any time */
+    uint32_t overflow;      /*!< Requests served by the heap because the pool could not provide a block */
+    bool spiram;            /*!< Pool is in PSRAM */
+} bsp_lv_mem_class_stats_t;
+
+/**
+ * @brief Get usage of the LVGL size classes
+ *
+ * @param[out] stats Array of BSP_LV_MEM_CLASSES items, smallest class first
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_lv_mem_get_class_stats(bsp_lv_mem_class_stats_t *stats);
+#endif
+
+#if CONFIG_BSP_IMG_RLE
+/**************************************************************************************************
+ *
+ * RLE compressed images
+ *
+ * Images generated with bsp_add_images(RLE) are lv_img_dsc_t with the BSP_IMG_CF_RLE color format.
+ * They are drawn with lv_img like any other image, the BSP decoder registered by bsp_display_start()
+ * decodes the lines LVGL asks for into RGB565 (+ A8 when the image has transparent pixels).
+ *
+ * Data layout: bsp_img_rle_header_t, the offset of every line from the start of the data and the
+ * encoded lines. A line is a sequence of packets, each starting with a control byte:
+ *   - bit 7 set:   (ctrl & 0x7F) + 1 copies of the one pixel that follows
+ *   - bit 7 clear: ctrl + 1 pixels follow
+ * Pixels are in the decoded format, packets do not cross lines.
+ *
+ * LVGL 8.3 zooms and rotates only images it gets whole, so transformed RLE images must come from
+ * the PSRAM cache (CONFIG_BSP_IMG_RLE_CACHE).
+ **************************************************************************************************/
+#define BSP_IMG_CF_RLE      LV_IMG_CF_USER_ENCODED_0
+#define BSP_IMG_RLE_MAGIC   (0x31454C52)    // "RLE1"
+
+/**
+ * @brief Header of BSP_IMG_CF_RLE image data
+ *
+ */
+typedef struct {
+    uint32_t magic;             /*!< BSP_IMG_RLE_MAGIC */
+    uint8_t px_size;            /*!< Bytes per decoded pixel: 2 for RGB565, 3 for RGB565 + A8 */
+    uint8_t reserved[3];
+    uint32_t line_offset[];     /*!< Offset of every encoded line from the start of the data */
+} bsp_img_rle_header_t;
+
+/**
+ * @brief Decoder and cache counters
+ *
+ */
+typedef struct {
+    uint32_t opens;             /*!< Images opened by LVGL */
+    uint32_t lines;             /*!< Lines decoded for LVGL draws */
+    uint32_t cache_hits;        /*!< Opens served from the PSRAM cache */
+    uint32_t cache_fills;       /*!< Images decoded into the cache */
+    uint32_t cache_evictions;   /*!< Images dropped from the cache to make room */
+    uint32_t cache_bytes;       /*!< Bytes of decoded images in the cache */
+} bsp_img_rle_stats_t;
+
+/**
+ * @brief Get decoder and cache counters
+ *
+ * @param[out] stats Counters since start-up
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_img_rle_get_stats(bsp_img_rle_stats_t *stats);
+
+/**
+ * @brief Drop all decoded images from the PSRAM cache
+ *
+ * Images LVGL still has open are kept. Without CONFIG_BSP_IMG_RLE_CACHE it does nothing.
+ */
+void bsp_img_rle_cache_drop(void);
+
+#if CONFIG_BSP_IMG_RLE_BENCHMARK
+/**
+ * @brief Raw and RLE compressed version of one image for bsp_img_rle_benchmark()
+ *
+ */
+typedef struct {
+    const char *name;           /*!< Name for the log */
+    const lv_img_dsc_t *raw;    /*!< Image in LV_IMG_CF_TRUE_COLOR or LV_IMG_CF_TRUE_COLOR_ALPHA */
+    const lv_img_dsc_t *rle;    /*!< Same image in BSP_IMG_CF_RLE */
+} bsp_img_rle_bench_image_t;
+
+/**
+ * @brief Result of bsp_img_rle_benchmark() for one image
+ *
+ */
+typedef struct {
+    uint32_t raw_bytes;         /*!< Size of the raw image data */
+    uint32_t rle_bytes;         /*!< Size of the RLE image data */
+    uint32_t raw_us;            /*!< Average draw time of the raw image in [us] */
+    uint32_t rle_us;            /*!< Average draw time of the RLE image, decoded line by line, in [us] */
+    uint32_t cached_us;         /*!< Average draw time of the RLE image from the PSRAM cache in [us], 0 without cache */
+} bsp_img_rle_bench_result_t;
+
+/**
+ * @brief Compare draw times of raw and RLE compressed images
+ *
+ * Every image is drawn CONFIG_BSP_IMG_RLE_BENCHMARK_DRAWS times into an off-screen canvas from the
+ * raw data, from the RLE data decoded line by line and, with CONFIG_BSP_IMG_RLE_CACHE, from the
+ * RLE data decoded once into PSRAM. Results are logged as a table.
+ *
+ * @note Call it after bsp_display_start(), it takes the display lock.
+ *
+ * @param[in]  images  Array of images to measure
+ * @param[in]  count   Number of items in images
+ * @param[out] results Array of count results, may be NULL when only the log is needed
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error, or the two versions of an image differ in size
+ *      - ESP_ERR_NO_MEM        Not enough memory for the canvas
+ */
+esp_err_t bsp_img_rle_benchmark(const bsp_img_rle_bench_image_t *images, size_t count, bsp_img_rle_bench_result_t *results);
+#endif
+#endif
+
+#if CONFIG_BSP_ASSETS
+/**************************************************************************************************
+ *
+ * Assets partition
+ *
+ * Images and other files packed by bsp_add_assets() into the CONFIG_BSP_ASSETS_PARTITION_LABEL
+ * partition. The partition is mapped into the address space and everything is used in place:
+ * \code{.c}
+ * lv_img_set_src(img, bsp_assets_get_img("esp_logo"));
+ * \endcode
+ *
+ * Layout: bsp_assets_header_t, count bsp_assets_entry_t sorted by name, then the data of every
+ * entry, 4-byte aligned. Offsets are from the start of the partition.
+ **************************************************************************************************/
+#define BSP_ASSETS_MAGIC        (0x41505342)    // "BSPA"
+#define BSP_ASSETS_VERSION      (1)
+#define BSP_ASSETS_FLAG_SWAP    (1 << 0)        // Images were packed for LV_COLOR_16_SWAP
+#define BSP_ASSETS_NAME_LEN     (24)
+
+/**
+ * @brief Header at the start of the assets partition
+ *
+ */
+typedef struct {
+    uint32_t magic;             /*!< BSP_ASSETS_MAGIC */
+    uint16_t version;           /*!< BSP_ASSETS_VERSION */
+    uint16_t flags;             /*!< BSP_ASSETS_FLAG_x */
+    uint32_t count;             /*!< Number of entries */
+    uint32_t size;              /*!< Size of the container in [B], header included */
+    uint32_t crc32;             /*!< CRC-32 of the container after the header */
+} bsp_assets_header_t;
+
+/**
+ * @brief Entry of the assets table
+ *
+ */
+typedef struct {
+    char name[BSP_ASSETS_NAME_LEN]; /*!< Zero terminated name: file name of data, without extension for images */
+    uint32_t offset;            /*!< Offset of the data in [B] */
+    uint32_t size;              /*!< Size of the data in [B] */
+    uint16_t width;             /*!< Image width, 0 for data */
+    uint16_t height;            /*!< Image height, 0 for data */
+    uint8_t type;               /*!< bsp_asset_type_t */
+    uint8_t reserved[3];
+} bsp_assets_entry_t;
+
+/**
+ * @brief Map the assets partition
+ *
+ * Called by bsp_display_start(), call it earlier to use assets before the display is started.
+ * The header and the table are checked, and the CRC with CONFIG_BSP_ASSETS_VERIFY.
+ *
+ * @return
+ *      - ESP_OK                On success, or when already mapped
+ *      - ESP_ERR_NOT_FOUND     No partition with the label, or nothing packed in it
+ *      - ESP_ERR_INVALID_VERSION Partition was not packed by this version of bsp_add_assets()
+ *      - ESP_ERR_INVALID_CRC   Contents are corrupted
+ *      - ESP_ERR_INVALID_SIZE  Table does not fit the partition
+ *      - ESP_ERR_NOT_SUPPORTED Images were packed for another LV_COLOR_16_SWAP
+ *      - ESP_ERR_NO_MEM        Not enough memory for the image descriptors
+ *      - other error codes from esp_partition
+ */
+esp_err_t bsp_assets_mount(void);
+
+/**
+ * @brief Unmap the assets partition, e.g. before it is rewritten
+ *
+ * @attention Descriptors and data returned by bsp_assets_get_img() and bsp_assets_get_data() are
+ *            invalid afterwards, LVGL must not use them anymore.
+ */
+void bsp_assets_unmount(void);
+
+/**
+ * @brief Get an image from the assets partition
+ *
+ * @param[in] name Image name, the PNG file name without extension
+ * @return Image descriptor with the data in the mapped partition, NULL when there is no such image
+ */
+const lv_img_dsc_t *bsp_assets_get_img(const char *name);
+
+/**
+ * @brief Get any asset from the assets partition
+ *
+ * @param[in]  name  Asset name
+ * @param[out] data  Asset data in the mapped partition
+ * @param[out] size  Size of the data in [B], may be NULL
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_INVALID_STATE Partition is not mapped
+ *      - ESP_ERR_NOT_FOUND     No such asset
+ */
+esp_err_t bsp_assets_get_data(const char *name, const void **data, size_t *size);
+#endif
+
+#if CONFIG_BSP_FONT
+/**************************************************************************************************
+ *
+ * External fonts
+ *
+ * LVGL binary fonts (lv_font_conv --format bin) loaded at run time, so sizes and scripts that are
+ * not compiled into the app only take room on the uSD card or in the assets partition:
+ * \code{.c}
+ * lv_font_t *font = bsp_font_load(BSP_MOUNT_POINT "/fonts/noto_sans_sc_24.bin");
+ * font->fallback = &lv_font_montserrat_20;     // Symbols and characters the font does not have
+ * lv_obj_set_style_text_font(label, font, 0);
+ * \endcode
+ * Only the character maps and the glyph metrics are kept in RAM. The bitmap of a glyph is read when
+ * LVGL draws it the first time, decompressed, and kept in a glyph cache of CONFIG_BSP_FONT_CACHE_KB
+ * shared by all fonts. Least recently drawn glyphs are dropped when the cache is full. A font file
+ * up to CONFIG_BSP_FONT_PRELOAD_KB is read into PSRAM at load time and used like an asset, so drawing
+ * never reads the card. Uncompressed fonts in the assets partition or preloaded whose bitmaps are
+ * byte aligned are drawn in place, without the cache.
+ *
+ * Glyphs of larger font files are read by the LVGL task, under the display lock, so the file system
+ * has to stay mounted while the font is used. Fonts from the assets partition must be freed before
+ * bsp_assets_unmount(). Kerning is not loaded, and fonts with 3 bpp are not supported.
+ **************************************************************************************************/
+
+/**
+ * @brief Glyph cache counters
+ *
+ * The hit rate is hits / (hits + misses).
+ */
+typedef struct {
+    uint32_t fonts;             /*!< Fonts loaded */
+    uint32_t hits;              /*!< Glyph bitmaps served from the cache */
+    uint32_t misses;            /*!< Glyph bitmaps read and decoded into the cache */
+    uint32_t direct;            /*!< Glyph bitmaps drawn in place from the assets partition or a preload */
+    uint32_t evictions;         /*!< Glyphs dropped to make room */
+    uint32_t errors;            /*!< Glyphs not drawn: read failed or no memory */
+    uint32_t glyphs;            /*!< Glyphs in the cache */
+    uint32_t cache_bytes;       /*!< Bytes of the cache in use, bookkeeping included */
+    uint64_t miss_us;           /*!< Total time of the misses in [us] */
+    uint32_t miss_us_max;       /*!< Longest miss in [us]. A miss of a font file that was not preloaded
+                                     reads the card with the display lock held, so it also includes waiting
+                                     for other card users such as the audio reader, and stalls rendering */
+} bsp_font_stats_t;
+
+/**
+ * @brief Load an LVGL binary font
+ *
+ * A path starting with '/' is opened as a file, on the uSD card or any other mounted file system,
+ * and stays open until bsp_font_free(). Any other name is looked up in the assets partition
+ * (CONFIG_BSP_ASSETS), where files are stored by their name with extension.
+ *
+ * @param[in] path Font file path, or asset name
+ * @return Font to use in LVGL styles, NULL when it could not be loaded
+ */
+lv_font_t *bsp_font_load(const char *path);
+
+/**
+ * @brief Free a font returned by bsp_font_load() and drop its glyphs from the cache
+ *
+ * @attention Call with the display lock held, after no object uses the font anymore.
+ *
+ * @param[in] font Font to free, may be NULL
+ */
+void bsp_font_free(lv_font_t *font);
+
+/**
+ * @brief Get glyph cache counters
+ *
+ * @param[out] stats Counters since start-up or the last bsp_font_reset_stats()
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_font_get_stats(bsp_font_stats_t *stats);
+
+/**
+ * @brief Reset the glyph cache counters, the cache contents and the font count are kept
+ *
+ */
+void bsp_font_reset_stats(void);
+#endif
 
 #ifdef __cplusplus
 }
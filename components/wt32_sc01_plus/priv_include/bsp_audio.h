@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Layout of the 16 bit PCM data of an audio file
+ *
+ */
+typedef struct {
+    uint32_t sample_rate;       /*!< Frames per second */
+    uint16_t channels;          /*!< 1 or 2 */
+    long data_start;            /*!< File offset of the first frame */
+    uint32_t data_size;         /*!< Bytes of PCM data */
+} bsp_audio_format_t;
+
+/**
+ * @brief Find the 16 bit PCM data of a WAV file, or take the whole file as raw stereo PCM
+ *
+ * @param[in]  f      File positioned at its start
+ * @param[out] format Layout of the data, the file is left at its first frame
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_NOT_SUPPORTED WAV file of another format
+ *      - ESP_FAIL              Read or seek error
+ */
+esp_err_t bsp_audio_parse(FILE *f, bsp_audio_format_t *format);
+
+#if CONFIG_BSP_AUDIO_SFX
+/**
+ * @brief Start mixing effects, called by bsp_audio_init()
+ *
+ * @return
+ *      - ESP_OK                On success
+ */
+esp_err_t bsp_audio_sfx_init(void);
+
+/**
+ * @brief Stop the voices and refuse triggers, called by bsp_audio_deinit()
+ */
+void bsp_audio_sfx_deinit(void);
+
+/**
+ * @brief Start the triggered effects and mix the playing voices into one DMA buffer
+ *
+ * Called by the I2S task only.
+ *
+ * @param[in,out] frames      16 bit stereo frames, mixed with saturation
+ * @param[in]     count       Number of frames
+ * @param[in]     sample_rate Current output rate, effects of other rates are resampled
+ */
+void bsp_audio_sfx_mix(int16_t *frames, uint32_t count, uint32_t sample_rate);
+
+/**
+ * @brief Account the latency of the effects started by the last bsp_audio_sfx_mix()
+ *
+ * Called by the I2S task once the mixed buffer is in the DMA buffer.
+ *
+ * @param[in] queued_us Play time of the data queued in the DMA buffer ahead of the mixed buffer
+ */
+void bsp_audio_sfx_written(uint32_t queued_us);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "bsp/wt32_sc01_plus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Boot phases of the BSP bring-up, compiled out without CONFIG_BSP_BOOT_TIMING */
+#if CONFIG_BSP_BOOT_TIMING
+#define BSP_BOOT_PHASE_BEGIN(name)  bsp_boot_phase_begin(name)
+#define BSP_BOOT_PHASE_END(phase)   bsp_boot_phase_end(phase)
+#else
+#define BSP_BOOT_PHASE_BEGIN(name)  (-1)
+#define BSP_BOOT_PHASE_END(phase)   ((void)(phase))
+#endif
+
+#ifdef __cplusplus
+}
+#endif
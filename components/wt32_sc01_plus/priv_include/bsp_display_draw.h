@@ -0,0 +1,26 @@
+#pragma once
+
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Install the BSP blend kernels into the LVGL software renderer of the display
+ *
+ * With CONFIG_BSP_DISPLAY_DRAW_SELFTEST the kernels are verified first. When the PIE kernels
+ * do not match the LVGL reference the scalar kernels are tried, when those do not match either
+ * the LVGL blend is kept. The display works in every case.
+ *
+ * @param[in] disp LVGL display returned by lvgl_port_add_disp()
+ * @return
+ *      - ESP_OK                On success, also when the LVGL blend was kept
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ */
+esp_err_t bsp_display_draw_init(lv_disp_t *disp);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start the render helper task and split blends of the display between both cores
+ *
+ * Wraps the blend installed in the draw context, call it after bsp_display_draw_init().
+ *
+ * @param[in] disp LVGL display
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_NO_MEM        Not enough memory for the helper task
+ */
+esp_err_t bsp_display_dual_core_init(lv_disp_t *disp);
+
+#ifdef __cplusplus
+}
+#endif
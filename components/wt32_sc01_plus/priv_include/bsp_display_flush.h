@@ -0,0 +1,45 @@
+#pragma once
+
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Take over the LVGL flush path of the display
+ *
+ * Replaces the flush callback installed by esp_lvgl_port and the color transfer done callback of the
+ * panel IO, so that one LVGL flush may be sent to the panel as several transfers.
+ * With CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR it also enables the TE output of the panel and starts each
+ * frame on the TE edge. With CONFIG_BSP_DISPLAY_FLUSH_PIPELINE it allocates the extra band buffers
+ * and starts the flush task.
+ *
+ * @param[in] disp  LVGL display returned by lvgl_port_add_disp()
+ * @param[in] io    Panel IO handle of the display
+ * @param[in] panel Panel handle of the display
+ * @param[in] max_transfer_bytes Largest color transfer of the i80 bus, bigger areas are split into row chunks
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_NO_MEM        Not enough memory
+ *      - other error codes from GPIO or esp_lcd drivers
+ */
+esp_err_t bsp_display_flush_init(lv_disp_t *disp, esp_lcd_panel_io_handle_t io, esp_lcd_panel_handle_t panel,
+                                 size_t max_transfer_bytes);
+
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+/**
+ * @brief Wait until every queued band is sent to the panel
+ *
+ * Call it with the LVGL lock held before sending commands to the panel outside of the flush path.
+ */
+void bsp_display_flush_drain(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start touch-to-photon latency measurement
+ *
+ * Hooks the feedback callback of the touch input device to see when LVGL processes a press.
+ * Without CONFIG_BSP_TOUCH_IRQ it also adds a GPIO interrupt handler on BSP_LCD_TP_INT.
+ *
+ * @param[in] indev Touch input device
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - other error codes from GPIO or esp_timer drivers
+ */
+esp_err_t bsp_display_latency_init(lv_indev_t *indev);
+
+/**
+ * @brief Falling edge of the touch INT line, callable from ISR
+ */
+void bsp_display_latency_touch_edge(void);
+
+/**
+ * @brief LVGL flushes an area of the refresh, called from the flush callback
+ *
+ * @param[in] last The area is the last one of the refresh
+ */
+void bsp_display_latency_flush(bool last);
+
+/**
+ * @brief All color transfers of a flush are done, callable from ISR
+ */
+void bsp_display_latency_flush_done(void);
+
+#ifdef __cplusplus
+}
+#endif
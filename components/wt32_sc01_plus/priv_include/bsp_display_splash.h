@@ -0,0 +1,28 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Send the splash frame to the panel and wait until it is transferred
+ *
+ * Registers its own color transfer done callback of the panel IO and removes it before returning,
+ * call it before LVGL takes over the panel.
+ *
+ * @param[in] io    Panel IO handle of the display
+ * @param[in] panel Panel handle of the display
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_NO_MEM        Not enough DMA capable memory for the band buffers
+ *      - other error codes from esp_lcd drivers
+ */
+esp_err_t bsp_display_splash_show(esp_lcd_panel_io_handle_t io, esp_lcd_panel_handle_t panel);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start per-stage frame timing
+ *
+ * Wraps the LVGL refresh timer and wait callback, call it after bsp_display_flush_init().
+ *
+ * @param[in] disp LVGL display
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - other error codes from esp_timer
+ */
+esp_err_t bsp_display_timing_init(lv_disp_t *disp);
+
+/**
+ * @brief Flush callback entered
+ */
+void bsp_display_timing_flush_begin(void);
+
+/**
+ * @brief Flush callback returns, all transfers of the flush are queued
+ *
+ * @param[in] bytes Color bytes queued by the flush
+ */
+void bsp_display_timing_flush_end(uint32_t bytes);
+
+/**
+ * @brief All color transfers of a flush are done, callable from ISR
+ */
+void bsp_display_timing_flush_done(void);
+
+/**
+ * @brief Display lock taken by bsp_display_lock()
+ *
+ * @param[in] start_us Time the lock was requested
+ */
+void bsp_display_timing_locked(int64_t start_us);
+
+/**
+ * @brief Display lock about to be released by bsp_display_unlock()
+ */
+void bsp_display_timing_unlock(void);
+
+#ifdef __cplusplus
+}
+#endif
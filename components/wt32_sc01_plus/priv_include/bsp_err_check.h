@@ -20,6 +20,7 @@ extern "C" {
 #define BSP_ERROR_CHECK(x, ret)          ESP_ERROR_CHECK(x)
 #define BSP_NULL_CHECK(x, ret)           assert(x)
 #define BSP_NULL_CHECK_GOTO(x, goto_tag) assert(x)
+#define BSP_ERROR_CHECK_GOTO(x, goto_tag) ESP_ERROR_CHECK(x)
 #else
 #define BSP_ERROR_CHECK_RETURN_ERR(x) do { \
         esp_err_t err_rc_ = (x);            \
@@ -57,6 +58,12 @@ extern "C" {
             goto goto_tag;      \
         }                       \
     } while(0)
+
+#define BSP_ERROR_CHECK_GOTO(x, goto_tag) do { \
+        if (unlikely((x) != ESP_OK)) {    \
+            goto goto_tag;                \
+        }                                 \
+    } while(0)
 #endif
 
 #ifdef __cplusplus
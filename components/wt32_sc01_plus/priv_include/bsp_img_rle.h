@@ -0,0 +1,22 @@
+#pragma once
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Register the LVGL decoder of BSP_IMG_CF_RLE images
+ *
+ * Call it after lvgl_port_init(), it takes the display lock.
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_NO_MEM        Not enough memory for the decoder
+ */
+esp_err_t bsp_img_rle_init(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "bsp/wt32_sc01_plus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_BSP_HEAP_TELEMETRY_LVGL
+/**
+ * @brief Get the counters of the LVGL allocator
+ *
+ * The frag_pct field is not filled in.
+ *
+ * @param[out] stats Counters since start
+ */
+void bsp_lv_mem_get_stats(bsp_heap_lvgl_stats_t *stats);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
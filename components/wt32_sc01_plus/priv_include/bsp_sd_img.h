@@ -0,0 +1,22 @@
+#pragma once
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Register the LVGL decoder of uSD card images and start the prefetch task
+ *
+ * Call it after lvgl_port_init(), it takes the display lock. The card does not have to be mounted yet.
+ *
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_NO_MEM        Not enough memory for the decoder, the task or the read buffer
+ */
+esp_err_t bsp_sd_img_init(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Mount the microSD card like bsp_sdcard_mount(), at another SPI clock
+ *
+ * @param[in] freq_khz Highest SPI clock in [kHz], the card may limit it further
+ * @return
+ *      - return value of bsp_sdcard_mount()
+ */
+esp_err_t bsp_sdcard_mount_freq(uint32_t freq_khz);
+
+#ifdef __cplusplus
+}
+#endif
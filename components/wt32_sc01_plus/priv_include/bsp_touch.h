@@ -0,0 +1,33 @@
+#pragma once
+
+#include "esp_lcd_touch.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Interrupt callback of the touch controller
+ *
+ * Set it as interrupt_callback of esp_lcd_touch_config_t. Runs in ISR context.
+ *
+ * @param[in] tp Touch handle
+ */
+void bsp_touch_isr(esp_lcd_touch_handle_t tp);
+
+/**
+ * @brief Add interrupt driven touch input to LVGL
+ *
+ * Starts the task that reads the controller on interrupt into the event queue and registers
+ * the LVGL input device that reads from the queue.
+ *
+ * @param[in] disp LVGL display the input belongs to
+ * @param[in] tp   Touch handle created with bsp_touch_isr() as interrupt callback
+ * @return Pointer to LVGL input device or NULL when error occured
+ */
+lv_indev_t *bsp_touch_indev_init(lv_disp_t *disp, esp_lcd_touch_handle_t tp);
+
+#ifdef __cplusplus
+}
+#endif
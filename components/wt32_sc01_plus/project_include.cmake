@@ -0,0 +1,2 @@
+include(${CMAKE_CURRENT_LIST_DIR}/cmake/bsp_images.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/cmake/bsp_assets.cmake)
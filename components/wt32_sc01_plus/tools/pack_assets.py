@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+#
+# Pack images and other files into the assets partition image read by bsp_assets.c.
+#
+# PNG files become images in the RGB565 format of the firmware (see png2lvgl.py), named after the
+# file without extension. Any other file is stored as it is, named after the file with extension.
+# The container layout is bsp_assets_header_t, the bsp_assets_entry_t table sorted by name and the
+# data of every entry, see bsp/wt32_sc01_plus.h.
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import png2lvgl  # noqa: E402
+
+ASSETS_MAGIC = b'BSPA'
+ASSETS_VERSION = 1
+ASSETS_FLAG_SWAP = 0x0001
+ASSETS_NAME_LEN = 24
+ASSETS_ALIGN = 4
+# bsp_assets_header_t and bsp_assets_entry_t
+HEADER_FORMAT = '<4sHHIII'
+ENTRY_FORMAT = '<{}sIIHHB3x'.format(ASSETS_NAME_LEN)
+
+
+def load_asset(path, swap, rle):
+    """Return (name, type, width, height, data) of one input file"""
+    base = os.path.basename(path)
+    stem, ext = os.path.splitext(base)
+    if ext.lower() != '.png':
+        with open(path, 'rb') as f:
+            return base, png2lvgl.ASSET_DATA, 0, 0, f.read()
+
+    width, height, pixels = png2lvgl.png_read_rgba(path)
+    alpha = any(p[3] != 0xFF for p in pixels)
+    data = png2lvgl.convert(pixels, swap, alpha)
+    if rle:
+        data = png2lvgl.rle_encode(data, width, height, 3 if alpha else 2)
+    return stem, png2lvgl.image_type(alpha, data if rle else None), width, height, data
+
+
+def pack(assets, swap):
+    assets = sorted(assets, key=lambda a: a[0].encode())
+    names = [a[0] for a in assets]
+    if len(set(names)) != len(names):
+        raise ValueError('duplicate asset names')
+
+    table_end = struct.calcsize(HEADER_FORMAT) + len(assets) * struct.calcsize(ENTRY_FORMAT)
+    data_start = (table_end + ASSETS_ALIGN - 1) & ~(ASSETS_ALIGN - 1)
+    offset = data_start
+    table = bytearray()
+    body = bytearray()
+    for name, atype, width, height, data in assets:
+        if len(name.encode()) >= ASSETS_NAME_LEN:
+            raise ValueError('asset name "{}" is longer than {} characters'.format(name, ASSETS_NAME_LEN - 1))
+        if width > 2047 or height > 2047:
+            raise ValueError('image "{}" is larger than the 2047x2047 LVGL limit'.format(name))
+        table += struct.pack(ENTRY_FORMAT, name.encode(), offset, len(data), width, height, atype)
+        body += data
+        pad = -len(data) % ASSETS_ALIGN
+        body += b'\0' * pad
+        offset += len(data) + pad
+
+    payload = table + b'\0' * (data_start - table_end) + body
+    flags = ASSETS_FLAG_SWAP if swap else 0
+    header = struct.pack(HEADER_FORMAT, ASSETS_MAGIC, ASSETS_VERSION, flags, len(assets),
+                         struct.calcsize(HEADER_FORMAT) + len(payload), zlib.crc32(payload) & 0xFFFFFFFF)
+    return header + payload
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack files into a BSP assets partition image')
+    parser.add_argument('files', nargs='+', help='PNG images and other files to pack')
+    parser.add_argument('-o', '--output', required=True, help='output partition image')
+    parser.add_argument('--size', type=lambda s: int(s, 0), help='partition size, fail when the image is larger')
+    parser.add_argument('--swap', action='store_true', help='swap the color bytes (LV_COLOR_16_SWAP)')
+    parser.add_argument('--rle', action='store_true', help='run-length encode the images (CONFIG_BSP_IMG_RLE)')
+    args = parser.parse_args()
+
+    try:
+        image = pack([load_asset(path, args.swap, args.rle) for path in args.files], args.swap)
+    except (OSError, ValueError, zlib.error) as e:
+        sys.exit('pack_assets: {}'.format(e))
+    if args.size is not None and len(image) > args.size:
+        sys.exit('pack_assets: {} B of assets do not fit the {} B partition'.format(len(image), args.size))
+
+    with open(args.output, 'wb') as f:
+        f.write(image)
+    print('Assets: {} files, {} B'.format(len(args.files), len(image)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,305 @@
+#!/usr/bin/env python
+#
+# Convert a PNG image into an LVGL 8 image descriptor in the RGB565 format of the firmware.
+#
+# Images with any transparent pixel become LV_IMG_CF_TRUE_COLOR_ALPHA (565 color and 8-bit alpha
+# per pixel), fully opaque ones LV_IMG_CF_TRUE_COLOR. With --rle the same pixels are run-length
+# encoded into the BSP_IMG_CF_RLE format of the BSP image decoder (see bsp/wt32_sc01_plus.h).
+# With --bin the image is written as a bsp_img_file_header_t and the data, to be loaded from the uSD card.
+# With --splash it becomes a bsp_display_splash_t for bsp_display_set_splash(), blended onto --bg.
+# Only the pure Python standard library is used, so the build does not depend on an imaging package.
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+# Channels of each PNG color type with 8 bits per sample
+PNG_CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+# BSP_IMG_RLE_MAGIC, 'RLE1' in memory
+RLE_MAGIC = b'RLE1'
+# Longest packet, the count is stored minus one in the low 7 bits of the control byte
+RLE_PACKET_MAX = 128
+# Shortest run worth a repeat packet, shorter ones stay in literal packets
+RLE_RUN_MIN = 3
+# Longest run of a splash {run length, color} pair
+SPLASH_RUN_MAX = 0xFFFF
+# bsp_asset_type_t
+ASSET_DATA = 0
+ASSET_IMG_RGB565 = 1
+ASSET_IMG_RGB565A8 = 2
+ASSET_IMG_RLE = 3
+# bsp_img_file_header_t
+IMG_FILE_MAGIC = b'BSPI'
+IMG_FILE_FORMAT = '<4sHHBBHI'
+IMG_FILE_FLAG_SWAP = 0x01
+IMG_FILE_FLAG_ALPHA = 0x02
+
+
+def png_unfilter(raw, width, height, bpp):
+    stride = width * bpp
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        ftype = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+            elif ftype != 0:
+                raise ValueError('unknown PNG filter type {}'.format(ftype))
+        rows.append(line)
+        prev = line
+    return rows
+
+
+def png_read_rgba(path):
+    """Return (width, height, list of RGBA tuples) of a non-interlaced 8-bit PNG"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError('not a PNG file')
+
+    pos = len(PNG_SIGNATURE)
+    idat = b''
+    palette = []
+    trns = b''
+    while pos < len(data):
+        length, ctype = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif ctype == b'PLTE':
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif ctype == b'tRNS':
+            trns = body
+        elif ctype == b'IDAT':
+            idat += body
+        elif ctype == b'IEND':
+            break
+    if depth != 8 or color not in PNG_CHANNELS or interlace:
+        raise ValueError('only non-interlaced 8-bit PNG images are supported')
+
+    bpp = PNG_CHANNELS[color]
+    rows = png_unfilter(zlib.decompress(idat), width, height, bpp)
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            s = line[x * bpp:(x + 1) * bpp]
+            if color == 6:
+                pixels.append(tuple(s))
+            elif color == 2:
+                pixels.append((s[0], s[1], s[2], 255))
+            elif color == 4:
+                pixels.append((s[0], s[0], s[0], s[1]))
+            elif color == 0:
+                pixels.append((s[0], s[0], s[0], 255))
+            else:
+                idx = s[0]
+                alpha = trns[idx] if idx < len(trns) else 255
+                pixels.append(palette[idx] + (alpha,))
+    return width, height, pixels
+
+
+def rgb565(r, g, b):
+    # Round to the nearest level instead of truncating, which darkens the image
+    r5 = min((r + 4) >> 3, 0x1F)
+    g6 = min((g + 2) >> 2, 0x3F)
+    b5 = min((b + 4) >> 3, 0x1F)
+    return (r5 << 11) | (g6 << 5) | b5
+
+
+def convert(pixels, swap, alpha):
+    out = bytearray()
+    for r, g, b, a in pixels:
+        c = rgb565(r, g, b)
+        out += struct.pack('>H' if swap else '<H', c)
+        if alpha:
+            out.append(a)
+    return out
+
+
+def rle_put_literal(out, literal):
+    for i in range(0, len(literal), RLE_PACKET_MAX):
+        chunk = literal[i:i + RLE_PACKET_MAX]
+        out.append(len(chunk) - 1)
+        for p in chunk:
+            out.extend(p)
+    del literal[:]
+
+
+def rle_encode_line(line, px_size):
+    """Encode the pixels of one line into repeat (bit 7 set) and literal packets"""
+    px = [bytes(line[i:i + px_size]) for i in range(0, len(line), px_size)]
+    out = bytearray()
+    literal = []
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < RLE_PACKET_MAX and px[i + run] == px[i]:
+            run += 1
+        if run >= RLE_RUN_MIN:
+            rle_put_literal(out, literal)
+            out.append(0x80 | (run - 1))
+            out.extend(px[i])
+        else:
+            literal.extend(px[i:i + run])
+        i += run
+    rle_put_literal(out, literal)
+    return out
+
+
+def rle_encode(data, width, height, px_size):
+    """Header, table of line offsets and the encoded lines, see bsp_img_rle_header_t"""
+    stride = width * px_size
+    lines = [rle_encode_line(data[y * stride:(y + 1) * stride], px_size) for y in range(height)]
+    header_size = 8 + 4 * height
+    out = bytearray(RLE_MAGIC + struct.pack('<B3x', px_size))
+    offset = header_size
+    for line in lines:
+        out += struct.pack('<I', offset)
+        offset += len(line)
+    for line in lines:
+        out += line
+    return out
+
+
+def write_c(path, name, src, width, height, data, alpha, swap, align, rle=None):
+    cf = 'LV_IMG_CF_TRUE_COLOR_ALPHA' if alpha else 'LV_IMG_CF_TRUE_COLOR'
+    fmt = 'RGB565 + A8' if alpha else 'RGB565, opaque'
+    if rle is not None:
+        # LV_IMG_CF_USER_ENCODED_0 is BSP_IMG_CF_RLE, kept literal so only lvgl.h is needed
+        cf = 'LV_IMG_CF_USER_ENCODED_0'
+        fmt += ', RLE {} of {} B'.format(len(rle), len(data))
+        data = rle
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x{:02x}'.format(b) for b in data[i:i + 16]) + ',')
+    with open(path, 'w') as f:
+        f.write('/* Generated from {} by png2lvgl.py, do not edit */\n'.format(os.path.basename(src)))
+        f.write('#include "lvgl.h"\n\n')
+        f.write('#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != {}\n'.format(1 if swap else 0))
+        f.write('#error "{} was converted for RGB565 with LV_COLOR_16_SWAP={}"\n'.format(name, 1 if swap else 0))
+        f.write('#endif\n\n')
+        f.write('#ifndef LV_ATTRIBUTE_LARGE_CONST\n#define LV_ATTRIBUTE_LARGE_CONST\n#endif\n\n')
+        f.write('/* {}x{} {} */\n'.format(width, height, fmt))
+        f.write('static const LV_ATTRIBUTE_LARGE_CONST uint8_t {}_map[] __attribute__((aligned({}))) = {{\n'.format(name, align))
+        f.write('\n'.join(lines))
+        f.write('\n};\n\n')
+        f.write('const lv_img_dsc_t {} = {{\n'.format(name))
+        f.write('    .header.cf = {},\n'.format(cf))
+        f.write('    .header.always_zero = 0,\n')
+        f.write('    .header.w = {},\n'.format(width))
+        f.write('    .header.h = {},\n'.format(height))
+        f.write('    .data_size = sizeof({}_map),\n'.format(name))
+        f.write('    .data = {}_map,\n'.format(name))
+        f.write('};\n')
+
+
+def bus_color(r, g, b):
+    # Splash colors are stored in the byte order of the 8-bit bus, most significant byte first
+    c = rgb565(r, g, b)
+    return ((c >> 8) | (c << 8)) & 0xFFFF
+
+
+def splash_encode(pixels, bg):
+    """Runs of {run length, color} over the whole image, row after row, blended onto the background"""
+    bg_rgb = ((bg >> 16) & 0xFF, (bg >> 8) & 0xFF, bg & 0xFF)
+    runs = []
+    for r, g, b, a in pixels:
+        rgb = [(c * a + bc * (255 - a) + 127) // 255 for c, bc in zip((r, g, b), bg_rgb)]
+        color = bus_color(*rgb)
+        if runs and runs[-1][1] == color and runs[-1][0] < SPLASH_RUN_MAX:
+            runs[-1][0] += 1
+        else:
+            runs.append([1, color])
+    return bus_color(*bg_rgb), runs
+
+
+def write_splash(path, name, src, width, height, pixels, bg):
+    bg_color, runs = splash_encode(pixels, bg)
+    words = [w for run in runs for w in run]
+    lines = []
+    for i in range(0, len(words), 12):
+        lines.append('    ' + ', '.join('0x{:04x}'.format(w) for w in words[i:i + 12]) + ',')
+    with open(path, 'w') as f:
+        f.write('/* Generated from {} by png2lvgl.py, do not edit */\n'.format(os.path.basename(src)))
+        f.write('#include "bsp/esp-bsp.h"\n\n')
+        f.write('/* {}x{} on 0x{:06X}, {} runs */\n'.format(width, height, bg, len(runs)))
+        f.write('static const uint16_t {}_rle[] = {{\n'.format(name))
+        f.write('\n'.join(lines))
+        f.write('\n};\n\n')
+        f.write('const bsp_display_splash_t {} = {{\n'.format(name))
+        f.write('    .bg_color = 0x{:04x},\n'.format(bg_color))
+        f.write('    .width = {},\n'.format(width))
+        f.write('    .height = {},\n'.format(height))
+        f.write('    .rle = {}_rle,\n'.format(name))
+        f.write('    .rle_words = sizeof({}_rle) / sizeof({}_rle[0]),\n'.format(name, name))
+        f.write('};\n')
+
+
+def image_type(alpha, rle):
+    if rle is not None:
+        return ASSET_IMG_RLE
+    return ASSET_IMG_RGB565A8 if alpha else ASSET_IMG_RGB565
+
+
+def write_bin(path, width, height, data, alpha, swap, rle=None):
+    data = rle if rle is not None else data
+    flags = (IMG_FILE_FLAG_SWAP if swap else 0) | (IMG_FILE_FLAG_ALPHA if alpha else 0)
+    with open(path, 'wb') as f:
+        f.write(struct.pack(IMG_FILE_FORMAT, IMG_FILE_MAGIC, width, height, image_type(alpha, rle), flags, 0, len(data)))
+        f.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a PNG into an LVGL RGB565 image descriptor')
+    parser.add_argument('png', help='input PNG image')
+    parser.add_argument('-o', '--output', required=True, help='output C file, or image file with --bin')
+    parser.add_argument('-n', '--name', help='descriptor name, the file name by default')
+    parser.add_argument('--swap', action='store_true', help='swap the color bytes (LV_COLOR_16_SWAP)')
+    parser.add_argument('--align', type=int, default=4, help='alignment of the pixel data in bytes')
+    parser.add_argument('--rle', action='store_true', help='run-length encode for the BSP image decoder')
+    parser.add_argument('--bin', action='store_true', help='write an image file for the uSD card instead of C')
+    parser.add_argument('--splash', action='store_true', help='write a bsp_display_splash_t instead of an image')
+    parser.add_argument('--bg', type=lambda v: int(v, 0), default=0, help='splash background color, RGB888')
+    args = parser.parse_args()
+
+    name = args.name or os.path.splitext(os.path.basename(args.png))[0]
+    try:
+        width, height, pixels = png_read_rgba(args.png)
+    except (OSError, ValueError, zlib.error) as e:
+        sys.exit('{}: {}'.format(args.png, e))
+
+    if args.splash:
+        write_splash(args.output, name, args.png, width, height, pixels, args.bg)
+        return
+
+    alpha = any(p[3] != 0xFF for p in pixels)
+    data = convert(pixels, args.swap, alpha)
+    rle = rle_encode(data, width, height, 3 if alpha else 2) if args.rle else None
+    if args.bin:
+        write_bin(args.output, width, height, data, alpha, args.swap, rle)
+    else:
+        write_c(args.output, name, args.png, width, height, data, alpha, args.swap, args.align, rle)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+#
+# Read the log files written by bsp_sd_log.c and print or extract their records.
+#
+# A log file is a sequence of blocks of CONFIG_BSP_SD_LOG_BLOCK_KB. Each block starts with
+# bsp_sd_log_block_t followed by its records, see bsp/wt32_sc01_plus.h. Blocks are written in
+# order from the start of the file, so a log is the run of valid blocks from block 0 whose sequence
+# numbers follow each other. The preallocated tail of a file and blocks left over from an older log
+# do not continue that run, a block whose CRC does not match ends it.
+
+import argparse
+import struct
+import sys
+import zlib
+
+LOG_MAGIC = 0x4C505342
+# bsp_sd_log_block_t
+HEADER_FORMAT = '<IIHHI'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+
+def read_blocks(path, block_size):
+    """Yield (index, seq, record_size, records) of the valid blocks of one log file, in file order"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    for offset in range(0, len(data) - block_size + 1, block_size):
+        magic, seq, record_size, count, crc = struct.unpack_from(HEADER_FORMAT, data, offset)
+        if magic != LOG_MAGIC or record_size == 0 or HEADER_SIZE + count * record_size > block_size:
+            continue
+        body = data[offset + HEADER_SIZE:offset + HEADER_SIZE + count * record_size]
+        if zlib.crc32(body) & 0xFFFFFFFF != crc:
+            print('{}: block {} (seq {}) has a bad CRC, skipped'.format(path, offset // block_size, seq),
+                  file=sys.stderr)
+            continue
+        records = [body[i:i + record_size] for i in range(0, len(body), record_size)]
+        yield offset // block_size, seq, record_size, records
+
+
+def chain(blocks):
+    """Keep the blocks from block 0 on whose sequence numbers follow each other, a log ends at a break"""
+    result = []
+    for index, seq, record_size, records in blocks:
+        if index != len(result) or (result and seq != (result[-1][0] + 1) & 0xFFFFFFFF):
+            break
+        result.append((seq, record_size, records))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Dump the records of BSP uSD card log files')
+    parser.add_argument('files', nargs='+', help='log files (log00001.bin ...) in order')
+    parser.add_argument('--block-kb', type=int, default=16, help='CONFIG_BSP_SD_LOG_BLOCK_KB')
+    parser.add_argument('-o', '--output', help='write the raw records to this file instead of printing them')
+    args = parser.parse_args()
+
+    try:
+        blocks = []
+        for path in args.files:
+            blocks += chain(read_blocks(path, args.block_kb * 1024))
+    except OSError as e:
+        sys.exit('sd_log_dump: {}'.format(e))
+
+    gaps = sum(1 for a, b in zip(blocks, blocks[1:]) if b[0] != (a[0] + 1) & 0xFFFFFFFF)
+    records = [r for block in blocks for r in block[2]]
+    if args.output:
+        with open(args.output, 'wb') as f:
+            f.write(b''.join(records))
+    else:
+        for seq, _, block_records in blocks:
+            for record in block_records:
+                print('{:10d} {}'.format(seq, record.hex()))
+    print('Log: {} blocks, {} records, {} sequence gaps'.format(len(blocks), len(records), gaps), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
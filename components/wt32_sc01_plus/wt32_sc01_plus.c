@@ -1,5 +1,10 @@
 
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "driver/gpio.h"
 #include "driver/ledc.h"
 #include "driver/spi_master.h"
@@ -14,12 +19,27 @@
 #include "esp_lvgl_port.h"
 #include "esp_vfs_fat.h"
 #include "bsp_err_check.h"
+#include "bsp_display_flush.h"
+#include "bsp_display_draw.h"
+#include "bsp_touch.h"
+#include "bsp_display_latency.h"
+#include "bsp_display_timing.h"
+#include "bsp_display_dual_core.h"
+#include "bsp_display_splash.h"
+#include "bsp_boot.h"
+#include "bsp_img_rle.h"
+#include "bsp_sd_img.h"
+#include "bsp_sdcard.h"
 
 static const char *TAG = "SC01_Plus";
 
 static lv_disp_t *disp;
 static lv_indev_t *disp_indev = NULL;
 static esp_lcd_touch_handle_t tp;   // LCD touch handle
+static esp_lcd_i80_bus_handle_t i80_bus = NULL;
+#if CONFIG_BSP_DISPLAY_HW_ROTATION
+static esp_lcd_panel_handle_t disp_panel = NULL;
+#endif
 sdmmc_card_t *bsp_sdcard = NULL;    // Global uSD card handler
 
 esp_err_t bsp_i2c_init(void)
@@ -46,7 +66,7 @@ esp_err_t bsp_i2c_deinit(void)
     return ESP_OK;
 }
 
-esp_err_t bsp_sdcard_mount(void)
+esp_err_t bsp_sdcard_mount_freq(uint32_t freq_khz)
 {
     const esp_vfs_fat_sdmmc_mount_config_t mount_config = {
 #ifdef CONFIG_BSP_SD_FORMAT_ON_MOUNT_FAIL
@@ -54,18 +74,19 @@ esp_err_t bsp_sdcard_mount(void)
 #else
         .format_if_mount_failed = false,
 #endif
-        .max_files = 5,
-        .allocation_unit_size = 16 * 1024
+        .max_files = CONFIG_BSP_SD_MAX_FILES,
+        .allocation_unit_size = CONFIG_BSP_SD_ALLOCATION_UNIT_KB * 1024
     };
 
-    const sdmmc_host_t host = SDSPI_HOST_DEFAULT();
+    sdmmc_host_t host = SDSPI_HOST_DEFAULT();
+    host.max_freq_khz = freq_khz;
     const spi_bus_config_t bus_cfg = {
         .mosi_io_num = BSP_SD_MOSI,
         .miso_io_num = BSP_SD_MISO,
         .sclk_io_num = BSP_SD_CLK,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
-        .max_transfer_sz = 4000,
+        .max_transfer_sz = CONFIG_BSP_SD_MAX_TRANSFER_SIZE,
     };
     BSP_ERROR_CHECK_RETURN_ERR(spi_bus_initialize(host.slot, &bus_cfg, SDSPI_DEFAULT_DMA));
     
@@ -75,12 +96,74 @@ esp_err_t bsp_sdcard_mount(void)
     slot_config.gpio_cs = BSP_SD_CS;
     slot_config.host_id = host.slot;
 
-    return esp_vfs_fat_sdspi_mount(BSP_MOUNT_POINT, &host, &slot_config, &mount_config, &bsp_sdcard);
+    const esp_err_t ret = esp_vfs_fat_sdspi_mount(BSP_MOUNT_POINT, &host, &slot_config, &mount_config, &bsp_sdcard);
+    if (ret != ESP_OK) {
+        /* Let a later mount initialize the bus again, e.g. after the card was inserted */
+        spi_bus_free(host.slot);
+    }
+    return ret;
+}
+
+esp_err_t bsp_sdcard_mount(void)
+{
+    return bsp_sdcard_mount_freq(CONFIG_BSP_SD_SPI_FREQ_KHZ);
 }
 
 esp_err_t bsp_sdcard_unmount(void)
 {
-    return esp_vfs_fat_sdcard_unmount(BSP_MOUNT_POINT, bsp_sdcard);
+    const sdmmc_host_t host = SDSPI_HOST_DEFAULT();
+    esp_err_t ret = esp_vfs_fat_sdcard_unmount(BSP_MOUNT_POINT, bsp_sdcard);
+    if (ret == ESP_OK) {
+        bsp_sdcard = NULL;
+        ret = spi_bus_free(host.slot);
+    }
+    return ret;
+}
+
+#define SD_MOUNT_TASK_STACK    (4096)
+
+static struct {
+    SemaphoreHandle_t done;     // Given once when the mount finished
+    esp_err_t ret;
+} s_sd_mount;
+
+static void bsp_sdcard_mount_task(void *arg)
+{
+    const int phase = BSP_BOOT_PHASE_BEGIN("sdcard");
+    s_sd_mount.ret = bsp_sdcard_mount();
+    BSP_BOOT_PHASE_END(phase);
+    xSemaphoreGive(s_sd_mount.done);
+    vTaskDelete(NULL);
+}
+
+esp_err_t bsp_sdcard_mount_async(void)
+{
+    if (s_sd_mount.done) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_sd_mount.done = xSemaphoreCreateBinary();
+    BSP_NULL_CHECK(s_sd_mount.done, ESP_ERR_NO_MEM);
+    if (xTaskCreate(bsp_sdcard_mount_task, "sd_mount", SD_MOUNT_TASK_STACK, NULL, uxTaskPriorityGet(NULL),
+                    NULL) != pdPASS) {
+        vSemaphoreDelete(s_sd_mount.done);
+        s_sd_mount.done = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_sdcard_mount_wait(uint32_t timeout_ms)
+{
+    if (s_sd_mount.done == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const TickType_t timeout = timeout_ms ? pdMS_TO_TICKS(timeout_ms) : portMAX_DELAY;
+    if (xSemaphoreTake(s_sd_mount.done, timeout) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    /* Let later waits return the same result */
+    xSemaphoreGive(s_sd_mount.done);
+    return s_sd_mount.ret;
 }
 
 // Bit number used to represent command and parameter
@@ -88,6 +171,56 @@ esp_err_t bsp_sdcard_unmount(void)
 #define LCD_PARAM_BITS         8
 #define LCD_LEDC_CH            CONFIG_BSP_DISPLAY_BRIGHTNESS_LEDC_CH
 
+#if CONFIG_BSP_LCD_I80_CLK_SRC_PLL240M
+#define LCD_I80_CLK_SRC        LCD_CLK_SRC_PLL240M
+#elif CONFIG_BSP_LCD_I80_CLK_SRC_XTAL
+#define LCD_I80_CLK_SRC        LCD_CLK_SRC_XTAL
+#else
+#define LCD_I80_CLK_SRC        LCD_CLK_SRC_PLL160M
+#endif
+
+#if CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+// Whole frame is sent in one transfer, draw buffers hold the full frame in PSRAM
+#define LCD_DRAW_BUFF_HEIGHT   (BSP_LCD_V_RES)
+#define LCD_DRAW_BUFF_DOUBLE   (1)
+#define LCD_DRAW_BUFF_SPIRAM   (1)
+#define LCD_DRAW_BUFF_RESERVE  (0)
+#else
+#define LCD_DRAW_BUFF_HEIGHT   (CONFIG_BSP_LCD_DRAW_BUF_HEIGHT)
+#define LCD_DRAW_BUFF_RESERVE  (CONFIG_BSP_LCD_DRAW_BUF_RESERVE_KB * 1024)
+#if CONFIG_BSP_LCD_DRAW_BUF_DOUBLE
+#define LCD_DRAW_BUFF_DOUBLE   (1)
+#else
+#define LCD_DRAW_BUFF_DOUBLE   (0)
+#endif
+#if CONFIG_BSP_LCD_DRAW_BUF_SPIRAM
+#define LCD_DRAW_BUFF_SPIRAM   (1)
+#else
+#define LCD_DRAW_BUFF_SPIRAM   (0)
+#endif
+#endif
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+#define LCD_DRAW_BUFF_COUNT    (CONFIG_BSP_DISPLAY_FLUSH_PIPELINE_DEPTH)
+#else
+#define LCD_DRAW_BUFF_COUNT    (2)
+#endif
+#define LCD_DRAW_BUFF_MIN_HEIGHT (10)
+#define LCD_MAX_TRANS_BYTES    (BSP_LCD_H_RES * LCD_DRAW_BUFF_HEIGHT * sizeof(uint16_t))
+
+/* LVGL draw buffer layout */
+typedef struct {
+    uint32_t lines;             // Band height in lines of BSP_LCD_H_RES pixels
+    bool double_buffer;
+    bool spiram;
+} bsp_display_buf_cfg_t;
+
+/* Free heap snapshot used by the memory budget report */
+typedef struct {
+    size_t internal_free;
+    size_t internal_largest;
+    size_t spiram_free;
+} bsp_display_heap_t;
+
 static esp_err_t bsp_display_brightness_init(void)
 {
     // Setup LEDC peripheral for PWM backlight control
@@ -141,15 +274,24 @@ esp_err_t bsp_display_backlight_on(void)
     return bsp_display_brightness_set(100);
 }
 
-static lv_disp_t *bsp_display_lcd_init(void)
+esp_err_t bsp_display_new(const bsp_display_config_t *config, esp_lcd_panel_handle_t *ret_panel, esp_lcd_panel_io_handle_t *ret_io)
 {
-    BSP_ERROR_CHECK_RETURN_NULL(bsp_display_brightness_init());
+    const bsp_display_config_t default_config = {
+        .pclk_hz = BSP_LCD_PIXEL_CLOCK_HZ,
+        .max_transfer_bytes = LCD_MAX_TRANS_BYTES,
+    };
+    if (config == NULL) {
+        config = &default_config;
+    }
+    BSP_NULL_CHECK(ret_panel, ESP_ERR_INVALID_ARG);
+    BSP_NULL_CHECK(ret_io, ESP_ERR_INVALID_ARG);
+
+    BSP_ERROR_CHECK_RETURN_ERR(bsp_display_brightness_init());
 
     ESP_LOGD(TAG, "Initialize Intel 8080 bus");
     /* Init Intel 8080 bus */
-    esp_lcd_i80_bus_handle_t i80_bus = NULL;
     esp_lcd_i80_bus_config_t bus_config = {
-        .clk_src = LCD_CLK_SRC_PLL160M,
+        .clk_src = LCD_I80_CLK_SRC,
         .dc_gpio_num = BSP_LCD_DC,
         .wr_gpio_num = BSP_LCD_WR,
         .data_gpio_nums = {
@@ -163,18 +305,17 @@ static lv_disp_t *bsp_display_lcd_init(void)
             BSP_LCD_DB7,
         },
         .bus_width = BSP_LCD_WIDTH,
-        .max_transfer_bytes = (BSP_LCD_H_RES) * 128 * sizeof(uint16_t),
+        .max_transfer_bytes = config->max_transfer_bytes,
         .psram_trans_align = 64,
         .sram_trans_align = 4,
     };
-    BSP_ERROR_CHECK_RETURN_NULL(esp_lcd_new_i80_bus(&bus_config, &i80_bus));
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_new_i80_bus(&bus_config, &i80_bus));
 
     ESP_LOGD(TAG, "Install panel IO");
-    esp_lcd_panel_io_handle_t io_handle = NULL;
     esp_lcd_panel_io_i80_config_t io_config = {
         .cs_gpio_num = BSP_LCD_CS,
-        .pclk_hz = BSP_LCD_PIXEL_CLOCK_HZ,
-        .trans_queue_depth = 10,
+        .pclk_hz = config->pclk_hz,
+        .trans_queue_depth = CONFIG_BSP_LCD_TRANS_QUEUE_DEPTH,
         .dc_levels = {
             .dc_idle_level = 0,
             .dc_cmd_level = 0,
@@ -188,36 +329,203 @@ static lv_disp_t *bsp_display_lcd_init(void)
         .lcd_cmd_bits = LCD_CMD_BITS,
         .lcd_param_bits = LCD_PARAM_BITS,
     };
-    BSP_ERROR_CHECK_RETURN_NULL(esp_lcd_new_panel_io_i80(i80_bus, &io_config, &io_handle));
+    *ret_io = NULL;
+    *ret_panel = NULL;
+    esp_err_t ret = esp_lcd_new_panel_io_i80(i80_bus, &io_config, ret_io);
+    if (ret != ESP_OK) {
+        goto err;
+    }
 
     ESP_LOGD(TAG, "Install LCD driver of ST7796");
-    esp_lcd_panel_handle_t panel_handle = NULL;
     esp_lcd_panel_dev_config_t panel_config = {
         .reset_gpio_num = BSP_LCD_RST,
         .rgb_endian = LCD_RGB_ENDIAN_BGR,
         .bits_per_pixel = 16,
         // .vendor_config = (void *) &vendor_config,
     };
-    BSP_ERROR_CHECK_RETURN_NULL(esp_lcd_new_panel_st7796(io_handle, &panel_config, &panel_handle));
+    ret = esp_lcd_new_panel_st7796(*ret_io, &panel_config, ret_panel);
+    if (ret == ESP_OK) {
+        ret = esp_lcd_panel_reset(*ret_panel);
+    }
+    if (ret == ESP_OK) {
+        ret = esp_lcd_panel_init(*ret_panel);
+    }
+    if (ret != ESP_OK) {
+        goto err;
+    }
 
-    BSP_ERROR_CHECK_RETURN_NULL(esp_lcd_panel_reset(panel_handle));
-    BSP_ERROR_CHECK_RETURN_NULL(esp_lcd_panel_init(panel_handle));
-    
     // Set inversion, x/y coordinate order, x/y mirror according to your LCD module spec
     // the gap is LCD panel specific, even panels with the same driver IC, can have different gap value
-    esp_lcd_panel_invert_color(panel_handle, true);
-    esp_lcd_panel_mirror(panel_handle, true, false);
+    esp_lcd_panel_invert_color(*ret_panel, true);
+    esp_lcd_panel_mirror(*ret_panel, true, false);
 
     // user can flush pre-defined pattern to the screen before we turn on the screen or backlight
-    BSP_ERROR_CHECK_RETURN_NULL(esp_lcd_panel_disp_on_off(panel_handle, true));
+    ret = esp_lcd_panel_disp_on_off(*ret_panel, true);
+    if (ret != ESP_OK) {
+        goto err;
+    }
+
+    return ESP_OK;
+
+err:
+    /* Nothing of the bus stays behind, so bsp_display_new() can be called again */
+    if (*ret_panel) {
+        esp_lcd_panel_del(*ret_panel);
+        *ret_panel = NULL;
+    }
+    if (*ret_io) {
+        esp_lcd_panel_io_del(*ret_io);
+        *ret_io = NULL;
+    }
+    esp_lcd_del_i80_bus(i80_bus);
+    i80_bus = NULL;
+    BSP_ERROR_CHECK_RETURN_ERR(ret);
+    return ret;
+}
+
+esp_err_t bsp_display_del(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io)
+{
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_panel_del(panel));
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_panel_io_del(io));
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_del_i80_bus(i80_bus));
+    i80_bus = NULL;
+
+    return ESP_OK;
+}
+
+static size_t bsp_display_buf_bytes(const bsp_display_buf_cfg_t *cfg)
+{
+    return BSP_LCD_H_RES * cfg->lines * sizeof(lv_color_t);
+}
+
+/* Band buffers of the layout, the flush pipeline adds its own to the two of LVGL */
+static size_t bsp_display_buf_count(const bsp_display_buf_cfg_t *cfg)
+{
+    return cfg->double_buffer ? LCD_DRAW_BUFF_COUNT : 1;
+}
+
+static bool bsp_display_buf_fits(const bsp_display_buf_cfg_t *cfg)
+{
+    const uint32_t caps = cfg->spiram ? MALLOC_CAP_SPIRAM : (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    const size_t reserve = cfg->spiram ? 0 : LCD_DRAW_BUFF_RESERVE;
+    const size_t size = bsp_display_buf_bytes(cfg);
+    const size_t count = bsp_display_buf_count(cfg);
+
+    return heap_caps_get_largest_free_block(caps) >= size &&
+           heap_caps_get_free_size(caps) >= count * size + reserve;
+}
+
+/* Pick the configured draw buffers, or the closest layout that fits into the current heap */
+static bool bsp_display_buf_select(bsp_display_buf_cfg_t *cfg)
+{
+    if (bsp_display_buf_fits(cfg)) {
+        return true;
+    }
+#if !CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+    const bsp_display_buf_cfg_t requested = *cfg;
+
+    /* Smaller bands cost only more render passes, try them first */
+    while (cfg->lines > LCD_DRAW_BUFF_MIN_HEIGHT) {
+        cfg->lines = LV_MAX(cfg->lines / 2, LCD_DRAW_BUFF_MIN_HEIGHT);
+        if (bsp_display_buf_fits(cfg)) {
+            return true;
+        }
+    }
+    if (cfg->double_buffer) {
+        cfg->double_buffer = false;
+        if (bsp_display_buf_fits(cfg)) {
+            return true;
+        }
+    }
+#if CONFIG_SPIRAM
+    if (!requested.spiram) {
+        *cfg = requested;
+        cfg->spiram = true;
+        if (bsp_display_buf_fits(cfg)) {
+            return true;
+        }
+    }
+#endif
+#endif
+    return false;
+}
+
+static void bsp_display_heap_get(bsp_display_heap_t *heap)
+{
+    heap->internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    heap->internal_largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    heap->spiram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+}
+
+static void bsp_display_buf_report(const bsp_display_buf_cfg_t *requested, const bsp_display_buf_cfg_t *used,
+                                   const bsp_display_heap_t *before, const bsp_display_heap_t *after)
+{
+    ESP_LOGI(TAG, "Display memory budget");
+    ESP_LOGI(TAG, "              | lines | buffers |  bytes | location");
+    ESP_LOGI(TAG, "  requested   | %5"PRIu32" | %7u | %6u | %s", requested->lines,
+             (unsigned)bsp_display_buf_count(requested), (unsigned)bsp_display_buf_bytes(requested), requested->spiram ? "PSRAM" : "internal DMA");
+    ESP_LOGI(TAG, "  used        | %5"PRIu32" | %7u | %6u | %s", used->lines, (unsigned)bsp_display_buf_count(used),
+             (unsigned)bsp_display_buf_bytes(used), used->spiram ? "PSRAM" : "internal DMA");
+    ESP_LOGI(TAG, "  max transfer: %u B", (unsigned)LCD_MAX_TRANS_BYTES);
+    ESP_LOGI(TAG, "  internal DMA: %u B free before, %u B free after (largest block %u B)",
+             (unsigned)before->internal_free, (unsigned)after->internal_free, (unsigned)after->internal_largest);
+    ESP_LOGI(TAG, "  PSRAM       : %u B free before, %u B free after",
+             (unsigned)before->spiram_free, (unsigned)after->spiram_free);
+    ESP_LOGI(TAG, "  display cost: %u B internal, %u B PSRAM",
+             (unsigned)(before->internal_free - after->internal_free), (unsigned)(before->spiram_free - after->spiram_free));
+}
+
+#if CONFIG_BSP_TOUCH_PARALLEL_INIT
+static esp_err_t bsp_touch_init_start(void);
+#endif
+
+static lv_disp_t *bsp_display_lcd_init(void)
+{
+    bsp_display_heap_t heap_before;
+    bsp_display_heap_get(&heap_before);
+
+    esp_lcd_panel_handle_t panel_handle = NULL;
+    esp_lcd_panel_io_handle_t io_handle = NULL;
+    int phase = BSP_BOOT_PHASE_BEGIN("panel");
+    BSP_ERROR_CHECK_RETURN_NULL(bsp_display_new(NULL, &panel_handle, &io_handle));
+    BSP_BOOT_PHASE_END(phase);
+    lv_disp_t *lcd_disp = NULL;
+#if CONFIG_BSP_TOUCH_PARALLEL_INIT
+    /* The touch controller is reset with the panel (BSP_LCD_RST), configure it only after that reset */
+    BSP_ERROR_CHECK_GOTO(bsp_touch_init_start(), err);
+#endif
+#if CONFIG_BSP_DISPLAY_SPLASH
+    /* First pixels on the screen, the panel RAM holds garbage until now so the backlight is still off */
+    phase = BSP_BOOT_PHASE_BEGIN("splash");
+    /* The splash is cosmetic, without it the backlight stays off until the application turns it on */
+    esp_err_t ret = bsp_display_splash_show(io_handle, panel_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Splash failed (%s)", esp_err_to_name(ret));
+    } else if (CONFIG_BSP_DISPLAY_SPLASH_BRIGHTNESS > 0) {
+        bsp_display_brightness_set(CONFIG_BSP_DISPLAY_SPLASH_BRIGHTNESS);
+    }
+    BSP_BOOT_PHASE_END(phase);
+#endif
+
+    const bsp_display_buf_cfg_t buf_requested = {
+        .lines = LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = LCD_DRAW_BUFF_DOUBLE,
+        .spiram = LCD_DRAW_BUFF_SPIRAM,
+    };
+    bsp_display_buf_cfg_t buf_cfg = buf_requested;
+    if (!bsp_display_buf_select(&buf_cfg)) {
+        ESP_LOGE(TAG, "Not enough memory for LVGL draw buffers");
+        goto err;
+    }
 
     /* Add LCD screen */
     ESP_LOGD(TAG, "Add LCD screen");
+    phase = BSP_BOOT_PHASE_BEGIN("lvgl display");
     const lvgl_port_display_cfg_t disp_cfg = {
         .io_handle = io_handle,
         .panel_handle = panel_handle,
-        .buffer_size = BSP_LCD_H_RES * 100,
-        .double_buffer = true,
+        .buffer_size = BSP_LCD_H_RES * buf_cfg.lines,
+        .double_buffer = buf_cfg.double_buffer,
         .hres = BSP_LCD_H_RES,
         .vres = BSP_LCD_V_RES,
         .monochrome = false,
@@ -228,19 +536,64 @@ static lv_disp_t *bsp_display_lcd_init(void)
             .mirror_y = false,
         },
         .flags = {
-            .buff_dma = true,
+            .buff_dma = !buf_cfg.spiram,
+            .buff_spiram = buf_cfg.spiram,
         }
     };
 
-    return lvgl_port_add_disp(&disp_cfg);
+    lcd_disp = lvgl_port_add_disp(&disp_cfg);
+    BSP_NULL_CHECK_GOTO(lcd_disp, err);
+#if CONFIG_BSP_DISPLAY_HW_ROTATION
+    disp_panel = panel_handle;
+#endif
+    BSP_ERROR_CHECK_GOTO(bsp_display_flush_init(lcd_disp, io_handle, panel_handle, LCD_MAX_TRANS_BYTES), err);
+#if CONFIG_BSP_DISPLAY_DRAW_ACCEL
+    BSP_ERROR_CHECK_GOTO(bsp_display_draw_init(lcd_disp), err);
+#endif
+#if CONFIG_BSP_DISPLAY_DUAL_CORE
+    BSP_ERROR_CHECK_GOTO(bsp_display_dual_core_init(lcd_disp), err);
+#endif
+#if CONFIG_BSP_DISPLAY_TIMING
+    BSP_ERROR_CHECK_GOTO(bsp_display_timing_init(lcd_disp), err);
+#endif
+#if CONFIG_BSP_IMG_RLE
+    BSP_ERROR_CHECK_GOTO(bsp_img_rle_init(), err);
+#endif
+#if CONFIG_BSP_SD_IMG
+    BSP_ERROR_CHECK_GOTO(bsp_sd_img_init(), err);
+#endif
+
+    BSP_BOOT_PHASE_END(phase);
+
+    bsp_display_heap_t heap_after;
+    bsp_display_heap_get(&heap_after);
+    bsp_display_buf_report(&buf_requested, &buf_cfg, &heap_before, &heap_after);
+
+    return lcd_disp;
+
+err:
+    /* Nothing of the display stays behind, the panel, its IO and the i80 bus are freed */
+    if (lcd_disp) {
+        lvgl_port_remove_disp(lcd_disp);
+    }
+#if CONFIG_BSP_DISPLAY_HW_ROTATION
+    disp_panel = NULL;
+#endif
+    bsp_display_backlight_off();
+    bsp_display_del(panel_handle, io_handle);
+    return NULL;
 }
 
-static lv_indev_t *bsp_display_indev_init(lv_disp_t *disp)
+static esp_err_t bsp_touch_new(void)
 {
-    /* Initialize touch */
     const esp_lcd_touch_config_t tp_cfg = {
+#if CONFIG_BSP_DISPLAY_HW_ROTATION
+        .x_max = BSP_LCD_H_RES, // Native (portrait) range of the controller, used for mirroring
+        .y_max = BSP_LCD_V_RES,
+#else
         .x_max = BSP_LCD_V_RES,
         .y_max = BSP_LCD_H_RES,
+#endif
         .rst_gpio_num = BSP_LCD_TP_RST, // Shared with LCD reset
         .int_gpio_num = BSP_LCD_TP_INT,
         .levels = {
@@ -252,13 +605,78 @@ static lv_indev_t *bsp_display_indev_init(lv_disp_t *disp)
             .mirror_x = 0,
             .mirror_y = 0,
         },
+#if CONFIG_BSP_TOUCH_IRQ
+        .interrupt_callback = bsp_touch_isr,
+#endif
     };
+#if CONFIG_BSP_TOUCH_IRQ
+    /* The ISR service may already be installed by another driver */
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_ERR_INVALID_STATE) {
+        BSP_ERROR_CHECK_RETURN_ERR(ret);
+    }
+#endif
     esp_lcd_panel_io_handle_t tp_io_handle = NULL;
     const esp_lcd_panel_io_i2c_config_t tp_io_config = ESP_LCD_TOUCH_IO_I2C_FT5x06_CONFIG();
-    BSP_ERROR_CHECK_RETURN_NULL(esp_lcd_new_panel_io_i2c((esp_lcd_i2c_bus_handle_t)BSP_I2C_NUM, &tp_io_config, &tp_io_handle));
-    BSP_ERROR_CHECK_RETURN_NULL(esp_lcd_touch_new_i2c_ft5x06(tp_io_handle, &tp_cfg, &tp));
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_new_panel_io_i2c((esp_lcd_i2c_bus_handle_t)BSP_I2C_NUM, &tp_io_config, &tp_io_handle));
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_touch_new_i2c_ft5x06(tp_io_handle, &tp_cfg, &tp));
     assert(tp);
 
+    return ESP_OK;
+}
+
+#if CONFIG_BSP_TOUCH_PARALLEL_INIT
+#define TOUCH_INIT_TASK_STACK  (4096)
+
+static struct {
+    SemaphoreHandle_t done;
+    esp_err_t ret;
+} s_tp_init;
+
+static void bsp_touch_init_task(void *arg)
+{
+    const int phase = BSP_BOOT_PHASE_BEGIN("touch");
+    s_tp_init.ret = bsp_touch_new();
+    BSP_BOOT_PHASE_END(phase);
+    xSemaphoreGive(s_tp_init.done);
+    vTaskDelete(NULL);
+}
+
+/* The controller is on I2C, bring it up while LVGL and the draw buffers are initialized */
+static esp_err_t bsp_touch_init_start(void)
+{
+    s_tp_init.done = xSemaphoreCreateBinary();
+    BSP_NULL_CHECK(s_tp_init.done, ESP_ERR_NO_MEM);
+    if (xTaskCreate(bsp_touch_init_task, "tp_init", TOUCH_INIT_TASK_STACK, NULL, uxTaskPriorityGet(NULL),
+                    NULL) != pdPASS) {
+        vSemaphoreDelete(s_tp_init.done);
+        s_tp_init.done = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/* Wait for the touch init task, which gives the semaphore as its last use of it */
+static esp_err_t bsp_touch_init_wait(void)
+{
+    xSemaphoreTake(s_tp_init.done, portMAX_DELAY);
+    vSemaphoreDelete(s_tp_init.done);
+    s_tp_init.done = NULL;
+    return s_tp_init.ret;
+}
+#endif
+
+static lv_indev_t *bsp_display_indev_init(lv_disp_t *disp)
+{
+#if CONFIG_BSP_TOUCH_PARALLEL_INIT
+    BSP_ERROR_CHECK_RETURN_NULL(bsp_touch_init_wait());
+#else
+    BSP_ERROR_CHECK_RETURN_NULL(bsp_touch_new());
+#endif
+
+#if CONFIG_BSP_TOUCH_IRQ
+    return bsp_touch_indev_init(disp, tp);
+#else
     /* Add touch input (for selected screen) */
     const lvgl_port_touch_cfg_t touch_cfg = {
         .disp = disp,
@@ -266,29 +684,129 @@ static lv_indev_t *bsp_display_indev_init(lv_disp_t *disp)
     };
 
     return lvgl_port_add_touch(&touch_cfg);
+#endif
 }
 
 lv_disp_t *bsp_display_start(void)
 {
-    const lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
-    BSP_ERROR_CHECK_RETURN_NULL(lvgl_port_init(&lvgl_cfg));
-    BSP_NULL_CHECK(disp = bsp_display_lcd_init(), NULL);
+    const int phase = BSP_BOOT_PHASE_BEGIN("display start");
+#if CONFIG_BSP_ASSETS
+    /* Without assets the display still starts, the images are just missing */
+    bsp_assets_mount();
+#endif
+    lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+#if CONFIG_BSP_DISPLAY_DUAL_CORE
+    /* The render helper is pinned to the other core */
+    lvgl_cfg.task_affinity = CONFIG_BSP_DISPLAY_DUAL_CORE_LVGL_CORE;
+#elif CONFIG_BSP_DISPLAY_DRAW_PIE && !CONFIG_FREERTOS_UNICORE
+    /* The PIE kernels keep state in vector registers, which may not follow the task to another core */
+    lvgl_cfg.task_affinity = CONFIG_BSP_DISPLAY_DRAW_PIE_CORE;
+#endif
+    const esp_err_t ret = lvgl_port_init(&lvgl_cfg);
+    disp = ret == ESP_OK ? bsp_display_lcd_init() : NULL;
+    if (disp == NULL) {
+#if CONFIG_BSP_TOUCH_PARALLEL_INIT
+        /* The touch init task may still be running, let it finish before giving up */
+        if (s_tp_init.done) {
+            bsp_touch_init_wait();
+        }
+#endif
+        BSP_ERROR_CHECK_RETURN_NULL(ret);
+        BSP_NULL_CHECK(disp, NULL);
+    }
     BSP_NULL_CHECK(disp_indev = bsp_display_indev_init(disp), NULL);
+#if CONFIG_BSP_DISPLAY_LATENCY
+    BSP_ERROR_CHECK_RETURN_NULL(bsp_display_latency_init(disp_indev));
+#endif
+    BSP_BOOT_PHASE_END(phase);
 
     return disp;
 }
 
+#if CONFIG_BSP_DISPLAY_HW_ROTATION
+/* Panel memory access order (MADCTL) and touch mapping for each rotation */
+typedef struct {
+    bool swap_xy;
+    bool panel_mirror_x;
+    bool panel_mirror_y;
+    bool tp_mirror_x;
+    bool tp_mirror_y;
+} bsp_display_orient_t;
+
+static const bsp_display_orient_t bsp_display_orient[] = {
+    [LV_DISP_ROT_NONE] = { .swap_xy = false, .panel_mirror_x = true,  .panel_mirror_y = false, .tp_mirror_x = false, .tp_mirror_y = false },
+    [LV_DISP_ROT_90]   = { .swap_xy = true,  .panel_mirror_x = true,  .panel_mirror_y = true,  .tp_mirror_x = false, .tp_mirror_y = true  },
+    [LV_DISP_ROT_180]  = { .swap_xy = false, .panel_mirror_x = false, .panel_mirror_y = true,  .tp_mirror_x = true,  .tp_mirror_y = true  },
+    [LV_DISP_ROT_270]  = { .swap_xy = true,  .panel_mirror_x = false, .panel_mirror_y = false, .tp_mirror_x = true,  .tp_mirror_y = false },
+};
+
+static void bsp_display_hw_rotate(lv_disp_t *disp, lv_disp_rot_t rotation)
+{
+    if (rotation > LV_DISP_ROT_270) {
+        ESP_LOGE(TAG, "Invalid rotation %d", rotation);
+        return;
+    }
+    const bsp_display_orient_t *orient = &bsp_display_orient[rotation];
+#if CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+    if (orient->swap_xy) {
+        ESP_LOGW(TAG, "Rotated by 90/270 the panel is written across its scan, TE sync cannot prevent tearing");
+    }
+#endif
+
+    bsp_display_lock(0);
+    /* LVGL sees a display with the rotated resolution and no rotation, nothing is rotated in software.
+     * The esp_lvgl_port update callback would program MADCTL for LV_DISP_ROT_NONE again, detach it. */
+    disp->driver->drv_update_cb = NULL;
+    disp->driver->sw_rotate = 0;
+    disp->driver->rotated = LV_DISP_ROT_NONE;
+    disp->driver->hor_res = orient->swap_xy ? BSP_LCD_V_RES : BSP_LCD_H_RES;
+    disp->driver->ver_res = orient->swap_xy ? BSP_LCD_H_RES : BSP_LCD_V_RES;
+
+#if CONFIG_BSP_DISPLAY_FLUSH_PIPELINE
+    /* The flush task may be between the window and the color data of a band */
+    bsp_display_flush_drain();
+#endif
+    /* Panel IO waits for pending color transfers before sending the new MADCTL */
+    esp_lcd_panel_swap_xy(disp_panel, orient->swap_xy);
+    esp_lcd_panel_mirror(disp_panel, orient->panel_mirror_x, orient->panel_mirror_y);
+    if (tp) {
+        esp_lcd_touch_set_swap_xy(tp, orient->swap_xy);
+        esp_lcd_touch_set_mirror_x(tp, orient->tp_mirror_x);
+        esp_lcd_touch_set_mirror_y(tp, orient->tp_mirror_y);
+    }
+
+    lv_disp_drv_update(disp, disp->driver);
+    bsp_display_unlock();
+}
+#endif
+
 void bsp_display_rotate(lv_disp_t *disp, lv_disp_rot_t rotation)
 {
+#if CONFIG_BSP_DISPLAY_HW_ROTATION
+    bsp_display_hw_rotate(disp, rotation);
+#else
     lv_disp_set_rotation(disp, rotation);
+#endif
 }
 
 bool bsp_display_lock(uint32_t timeout_ms)
 {
+#if CONFIG_BSP_DISPLAY_TIMING
+    const int64_t start = esp_timer_get_time();
+    if (!lvgl_port_lock(timeout_ms)) {
+        return false;
+    }
+    bsp_display_timing_locked(start);
+    return true;
+#else
     return lvgl_port_lock(timeout_ms);
+#endif
 }
 
 void bsp_display_unlock(void)
 {
+#if CONFIG_BSP_DISPLAY_TIMING
+    bsp_display_timing_unlock();
+#endif
     lvgl_port_unlock();
 }
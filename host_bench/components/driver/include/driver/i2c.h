@@ -0,0 +1,7 @@
+/*
+ * Host stand-in of driver/i2c.h, the host build has no I2C bus.
+ */
+
+#pragma once
+
+typedef int i2c_port_t;
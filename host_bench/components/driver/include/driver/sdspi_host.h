@@ -0,0 +1,7 @@
+/*
+ * Host stand-in of driver/sdspi_host.h, the card is only referenced by pointer.
+ */
+
+#pragma once
+
+typedef struct sdmmc_card_t sdmmc_card_t;
@@ -0,0 +1,225 @@
+#include <stdlib.h>
+#include <string.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_check.h"
+
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_lcd_mock.h"
+
+static const char *TAG = "lcd_mock";
+
+struct esp_lcd_panel_io_t {
+    esp_lcd_panel_io_mock_config_t config;
+    esp_lcd_panel_io_callbacks_t cbs;
+    void *user_ctx;
+    esp_lcd_panel_io_mock_stats_t stats;
+    uint16_t *gram;
+    bool swap_xy;           // MADCTL MV, columns and rows are exchanged
+    int x1, x2, y1, y2;     // Address window set by CASET/RASET, inclusive
+};
+
+struct esp_lcd_panel_t {
+    esp_lcd_panel_io_handle_t io;
+    uint8_t madctl;
+};
+
+static uint16_t mock_read_u16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+esp_err_t esp_lcd_new_panel_io_mock(const esp_lcd_panel_io_mock_config_t *config, esp_lcd_panel_io_handle_t *ret_io)
+{
+    ESP_RETURN_ON_FALSE(config && ret_io && config->pclk_hz && config->bus_width, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    esp_lcd_panel_io_handle_t io = calloc(1, sizeof(*io));
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_NO_MEM, TAG, "no mem for panel io");
+    io->gram = calloc(config->h_res * config->v_res, sizeof(uint16_t));
+    if (io->gram == NULL) {
+        free(io);
+        ESP_LOGE(TAG, "no mem for frame memory");
+        return ESP_ERR_NO_MEM;
+    }
+    io->config = *config;
+    io->x2 = config->h_res - 1;
+    io->y2 = config->v_res - 1;
+
+    *ret_io = io;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io)
+{
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    free(io->gram);
+    free(io);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_register_event_callbacks(esp_lcd_panel_io_handle_t io, const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx)
+{
+    ESP_RETURN_ON_FALSE(io && cbs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    io->cbs = *cbs;
+    io->user_ctx = user_ctx;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size)
+{
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    const uint8_t *p = param;
+
+    io->stats.param_trans++;
+    io->stats.cmd_bytes += 1 + param_size;
+
+    switch (lcd_cmd) {
+    case LCD_CMD_CASET:
+        ESP_RETURN_ON_FALSE(param_size == 4, ESP_ERR_INVALID_ARG, TAG, "CASET takes 4 bytes");
+        io->x1 = mock_read_u16(&p[0]);
+        io->x2 = mock_read_u16(&p[2]);
+        break;
+    case LCD_CMD_RASET:
+        ESP_RETURN_ON_FALSE(param_size == 4, ESP_ERR_INVALID_ARG, TAG, "RASET takes 4 bytes");
+        io->y1 = mock_read_u16(&p[0]);
+        io->y2 = mock_read_u16(&p[2]);
+        break;
+    case LCD_CMD_MADCTL:
+        ESP_RETURN_ON_FALSE(param_size == 1, ESP_ERR_INVALID_ARG, TAG, "MADCTL takes 1 byte");
+        io->swap_xy = p[0] & LCD_CMD_MV_BIT;
+        break;
+    default:
+        break;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color, size_t color_size)
+{
+    ESP_RETURN_ON_FALSE(io && color, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(lcd_cmd == LCD_CMD_RAMWR, ESP_ERR_NOT_SUPPORTED, TAG, "only RAMWR is supported");
+
+    const int cols = io->swap_xy ? io->config.v_res : io->config.h_res;
+    const int rows = io->swap_xy ? io->config.h_res : io->config.v_res;
+    ESP_RETURN_ON_FALSE(io->x1 <= io->x2 && io->x2 < cols && io->y1 <= io->y2 && io->y2 < rows, ESP_ERR_INVALID_STATE,
+                        TAG, "window (%d,%d)-(%d,%d) out of panel", io->x1, io->y1, io->x2, io->y2);
+
+    /* Pixels fill the window row by row, like the panel does */
+    const uint16_t *px = color;
+    const int width = io->x2 - io->x1 + 1;
+    const size_t count = color_size / sizeof(uint16_t);
+    for (size_t i = 0; i < count; i++) {
+        const int x = io->x1 + i % width;
+        const int y = io->y1 + i / width;
+        if (y > io->y2) {
+            ESP_LOGW(TAG, "%u pixels written past the window", (unsigned)(count - i));
+            break;
+        }
+        io->gram[y * cols + x] = px[i];
+    }
+
+    io->stats.color_trans++;
+    io->stats.cmd_bytes += 1;
+    io->stats.color_bytes += color_size;
+
+    if (io->cbs.on_color_trans_done) {
+        esp_lcd_panel_io_event_data_t edata = { };
+        io->cbs.on_color_trans_done(io, &edata, io->user_ctx);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_mock_get_stats(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_mock_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(io && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    *stats = io->stats;
+    const uint64_t clocks = (stats->cmd_bytes + stats->color_bytes) * 8 / io->config.bus_width;
+    stats->bus_time_us = clocks * 1000000ULL / io->config.pclk_hz;
+    return ESP_OK;
+}
+
+void esp_lcd_panel_io_mock_reset_stats(esp_lcd_panel_io_handle_t io)
+{
+    if (io) {
+        memset(&io->stats, 0, sizeof(io->stats));
+    }
+}
+
+const uint16_t *esp_lcd_panel_io_mock_get_gram(esp_lcd_panel_io_handle_t io)
+{
+    return io ? io->gram : NULL;
+}
+
+esp_err_t esp_lcd_new_panel_mock(esp_lcd_panel_io_handle_t io, esp_lcd_panel_handle_t *ret_panel)
+{
+    ESP_RETURN_ON_FALSE(io && ret_panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    esp_lcd_panel_handle_t panel = calloc(1, sizeof(*panel));
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_NO_MEM, TAG, "no mem for panel");
+    panel->io = io;
+    *ret_panel = panel;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_del(esp_lcd_panel_handle_t panel)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    free(panel);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_SWRESET, NULL, 0);
+}
+
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    const uint8_t colmod = 0x55; // 16 bits per pixel
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_SLPOUT, NULL, 0), TAG, "SLPOUT failed");
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_MADCTL, &panel->madctl, 1), TAG, "MADCTL failed");
+    return esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_COLMOD, &colmod, 1);
+}
+
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, const void *color_data)
+{
+    ESP_RETURN_ON_FALSE(panel && x_start < x_end && y_start < y_end, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    const uint8_t caset[] = { x_start >> 8, x_start & 0xFF, (x_end - 1) >> 8, (x_end - 1) & 0xFF };
+    const uint8_t raset[] = { y_start >> 8, y_start & 0xFF, (y_end - 1) >> 8, (y_end - 1) & 0xFF };
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_CASET, caset, sizeof(caset)), TAG, "CASET failed");
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_RASET, raset, sizeof(raset)), TAG, "RASET failed");
+    const size_t len = (x_end - x_start) * (y_end - y_start) * sizeof(uint16_t);
+    return esp_lcd_panel_io_tx_color(panel->io, LCD_CMD_RAMWR, color_data, len);
+}
+
+esp_err_t esp_lcd_panel_mirror(esp_lcd_panel_handle_t panel, bool mirror_x, bool mirror_y)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    panel->madctl &= ~(LCD_CMD_MX_BIT | LCD_CMD_MY_BIT);
+    panel->madctl |= (mirror_x ? LCD_CMD_MX_BIT : 0) | (mirror_y ? LCD_CMD_MY_BIT : 0);
+    return esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_MADCTL, &panel->madctl, 1);
+}
+
+esp_err_t esp_lcd_panel_swap_xy(esp_lcd_panel_handle_t panel, bool swap_axes)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    panel->madctl &= ~LCD_CMD_MV_BIT;
+    panel->madctl |= swap_axes ? LCD_CMD_MV_BIT : 0;
+    return esp_lcd_panel_io_tx_param(panel->io, LCD_CMD_MADCTL, &panel->madctl, 1);
+}
+
+esp_err_t esp_lcd_panel_invert_color(esp_lcd_panel_handle_t panel, bool invert_color_data)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return esp_lcd_panel_io_tx_param(panel->io, invert_color_data ? LCD_CMD_INVON : LCD_CMD_INVOFF, NULL, 0);
+}
+
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on_off)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return esp_lcd_panel_io_tx_param(panel->io, on_off ? LCD_CMD_DISPON : LCD_CMD_DISPOFF, NULL, 0);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Mock panel IO configuration
+ */
+typedef struct {
+    int h_res;              /*!< Horizontal resolution of the panel memory */
+    int v_res;              /*!< Vertical resolution of the panel memory */
+    uint32_t pclk_hz;       /*!< Pixel clock the bus time is estimated for */
+    int bus_width;          /*!< Data lines of the bus, bytes per clock = bus_width / 8 */
+} esp_lcd_panel_io_mock_config_t;
+
+/**
+ * @brief Transactions recorded by the mock panel IO
+ */
+typedef struct {
+    uint32_t param_trans;   /*!< Command transactions (with or without parameters) */
+    uint32_t color_trans;   /*!< Color transactions */
+    uint64_t cmd_bytes;     /*!< Command and parameter bytes */
+    uint64_t color_bytes;   /*!< Color bytes */
+    uint64_t bus_time_us;   /*!< Time the bytes would take on the real bus */
+} esp_lcd_panel_io_mock_stats_t;
+
+/**
+ * @brief Create mock panel IO
+ *
+ * Every transaction is counted and its bytes are kept in a frame memory, CASET/RASET/RAMWR
+ * are interpreted like the panel would do. Color transfers complete immediately: the done callback
+ * is called before esp_lcd_panel_io_tx_color() returns.
+ *
+ * @param[in]  config Mock configuration
+ * @param[out] ret_io Panel IO handle
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_NO_MEM        Not enough memory for the frame memory
+ */
+esp_err_t esp_lcd_new_panel_io_mock(const esp_lcd_panel_io_mock_config_t *config, esp_lcd_panel_io_handle_t *ret_io);
+
+/**
+ * @brief Create mock panel on a mock panel IO
+ *
+ * draw_bitmap sends CASET, RASET and RAMWR like the ST7796 driver, swap_xy and mirror send MADCTL.
+ *
+ * @param[in]  io        Mock panel IO handle
+ * @param[out] ret_panel Panel handle
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_NO_MEM        Not enough memory
+ */
+esp_err_t esp_lcd_new_panel_mock(esp_lcd_panel_io_handle_t io, esp_lcd_panel_handle_t *ret_panel);
+
+/**
+ * @brief Get transactions recorded since creation or the last reset
+ */
+esp_err_t esp_lcd_panel_io_mock_get_stats(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_mock_stats_t *stats);
+
+/**
+ * @brief Reset recorded transactions, the frame memory is kept
+ */
+void esp_lcd_panel_io_mock_reset_stats(esp_lcd_panel_io_handle_t io);
+
+/**
+ * @brief Get the frame memory, h_res x v_res RGB565 pixels in the byte order they were sent
+ */
+const uint16_t *esp_lcd_panel_io_mock_get_gram(esp_lcd_panel_io_handle_t io);
+
+#ifdef __cplusplus
+}
+#endif
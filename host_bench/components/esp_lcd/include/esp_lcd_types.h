@@ -0,0 +1,16 @@
+/*
+ * Host mock of esp_lcd, only the part of the API used by the BSP flush path.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t; /*!< Type of LCD panel IO handle */
+typedef struct esp_lcd_panel_t *esp_lcd_panel_handle_t;       /*!< Type of LCD panel handle */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,34 @@
+/*
+ * Host stand-in of esp_lvgl_port, only the LVGL mutex.
+ *
+ * There is no LVGL task on the host: the benchmark calls lv_timer_handler() itself,
+ * so the mutex only has to be recursive like the one of esp_lvgl_port.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Take LVGL mutex
+ *
+ * @param timeout_ms Timeout in [ms]. 0 will block indefinitely.
+ * @return true  Mutex was taken
+ * @return false Mutex was NOT taken
+ */
+bool lvgl_port_lock(uint32_t timeout_ms);
+
+/**
+ * @brief Give LVGL mutex
+ */
+void lvgl_port_unlock(void);
+
+#ifdef __cplusplus
+}
+#endif
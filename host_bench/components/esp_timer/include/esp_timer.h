@@ -0,0 +1,20 @@
+/*
+ * Host stand-in of esp_timer.h, only esp_timer_get_time().
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get time in microseconds since an arbitrary point before the application started
+ */
+int64_t esp_timer_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,235 @@
+#include <stdlib.h>
+#include "esp_err.h"
+#include "esp_log.h"
+
+#include "bsp/wt32_sc01_plus.h"
+#include "bsp_host.h"
+#include "esp_lcd_mock.h"
+#include "esp_lvgl_port.h"
+#include "bsp_err_check.h"
+#include "bsp_display_flush.h"
+#include "bsp_display_draw.h"
+#include "bsp_img_rle.h"
+
+static const char *TAG = "SC01_Plus_host";
+
+#define LCD_DRAW_BUFF_HEIGHT   (CONFIG_BSP_LCD_DRAW_BUF_HEIGHT)
+#if CONFIG_BSP_LCD_DRAW_BUF_DOUBLE
+#define LCD_DRAW_BUFF_DOUBLE   (1)
+#else
+#define LCD_DRAW_BUFF_DOUBLE   (0)
+#endif
+#define LCD_MAX_TRANS_BYTES    (BSP_LCD_H_RES * LCD_DRAW_BUFF_HEIGHT * sizeof(uint16_t))
+
+sdmmc_card_t *bsp_sdcard = NULL;    // There is no uSD card on the host
+
+static esp_lcd_panel_io_handle_t disp_io;
+static esp_lcd_panel_handle_t disp_panel;
+static struct {
+    bool pressed;
+    lv_coord_t x;
+    lv_coord_t y;
+} s_touch;
+
+esp_err_t bsp_i2c_init(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t bsp_i2c_deinit(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t bsp_sdcard_mount(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t bsp_sdcard_unmount(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t bsp_display_brightness_set(int brightness_percent)
+{
+    ESP_LOGD(TAG, "Setting LCD backlight: %d%%", brightness_percent);
+    return ESP_OK;
+}
+
+esp_err_t bsp_display_backlight_off(void)
+{
+    return bsp_display_brightness_set(0);
+}
+
+esp_err_t bsp_display_backlight_on(void)
+{
+    return bsp_display_brightness_set(100);
+}
+
+esp_err_t bsp_display_new(const bsp_display_config_t *config, esp_lcd_panel_handle_t *ret_panel, esp_lcd_panel_io_handle_t *ret_io)
+{
+    BSP_NULL_CHECK(ret_panel, ESP_ERR_INVALID_ARG);
+    BSP_NULL_CHECK(ret_io, ESP_ERR_INVALID_ARG);
+
+    const esp_lcd_panel_io_mock_config_t io_config = {
+        .h_res = BSP_LCD_H_RES,
+        .v_res = BSP_LCD_V_RES,
+        .pclk_hz = config ? config->pclk_hz : BSP_LCD_PIXEL_CLOCK_HZ,
+        .bus_width = BSP_LCD_WIDTH,
+    };
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_new_panel_io_mock(&io_config, ret_io));
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_new_panel_mock(*ret_io, ret_panel));
+
+    /* Same sequence as on the target, so the recorded commands match */
+    esp_lcd_panel_reset(*ret_panel);
+    esp_lcd_panel_init(*ret_panel);
+    esp_lcd_panel_invert_color(*ret_panel, true);
+    esp_lcd_panel_mirror(*ret_panel, true, false);
+    esp_lcd_panel_disp_on_off(*ret_panel, true);
+    return ESP_OK;
+}
+
+esp_err_t bsp_display_del(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io)
+{
+    BSP_ERROR_CHECK_RETURN_ERR(esp_lcd_panel_del(panel));
+    return esp_lcd_panel_io_del(io);
+}
+
+/* Only called until bsp_display_flush_init() installs the BSP flush path */
+static void bsp_host_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    lv_disp_flush_ready(drv);
+}
+
+static void bsp_host_touch_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+    data->point.x = s_touch.x;
+    data->point.y = s_touch.y;
+    data->state = s_touch.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static lv_disp_t *bsp_display_lcd_init(void)
+{
+    BSP_ERROR_CHECK_RETURN_NULL(bsp_display_new(NULL, &disp_panel, &disp_io));
+
+    const size_t buf_pixels = BSP_LCD_H_RES * LCD_DRAW_BUFF_HEIGHT;
+    lv_color_t *buf1 = malloc(buf_pixels * sizeof(lv_color_t));
+    lv_color_t *buf2 = LCD_DRAW_BUFF_DOUBLE ? malloc(buf_pixels * sizeof(lv_color_t)) : NULL;
+    BSP_NULL_CHECK(buf1, NULL);
+    if (LCD_DRAW_BUFF_DOUBLE) {
+        BSP_NULL_CHECK(buf2, NULL);
+    }
+
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, buf_pixels);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = BSP_LCD_H_RES;
+    disp_drv.ver_res = BSP_LCD_V_RES;
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = bsp_host_flush_cb;
+#if !CONFIG_BSP_DISPLAY_HW_ROTATION
+    disp_drv.sw_rotate = 1;
+#endif
+
+    lvgl_port_lock(0);
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+    lvgl_port_unlock();
+    BSP_NULL_CHECK(disp, NULL);
+
+    BSP_ERROR_CHECK_RETURN_NULL(bsp_display_flush_init(disp, disp_io, disp_panel, LCD_MAX_TRANS_BYTES));
+#if CONFIG_BSP_DISPLAY_DRAW_ACCEL
+    BSP_ERROR_CHECK_RETURN_NULL(bsp_display_draw_init(disp));
+#endif
+#if CONFIG_BSP_IMG_RLE
+    BSP_ERROR_CHECK_RETURN_NULL(bsp_img_rle_init());
+#endif
+    ESP_LOGI(TAG, "Mock display %dx%d, %d lines draw buffer%s", BSP_LCD_H_RES, BSP_LCD_V_RES, LCD_DRAW_BUFF_HEIGHT,
+             LCD_DRAW_BUFF_DOUBLE ? " x2" : "");
+    return disp;
+}
+
+static lv_indev_t *bsp_display_indev_init(lv_disp_t *disp)
+{
+    static lv_indev_drv_t indev_drv;
+    lv_indev_drv_init(&indev_drv);
+    indev_drv.type = LV_INDEV_TYPE_POINTER;
+    indev_drv.disp = disp;
+    indev_drv.read_cb = bsp_host_touch_read;
+
+    lvgl_port_lock(0);
+    lv_indev_t *indev = lv_indev_drv_register(&indev_drv);
+    lvgl_port_unlock();
+    return indev;
+}
+
+lv_disp_t *bsp_display_start(void)
+{
+    lv_init();
+
+    lv_disp_t *disp = bsp_display_lcd_init();
+    BSP_NULL_CHECK(disp, NULL);
+    BSP_NULL_CHECK(bsp_display_indev_init(disp), NULL);
+    return disp;
+}
+
+bool bsp_display_lock(uint32_t timeout_ms)
+{
+    return lvgl_port_lock(timeout_ms);
+}
+
+void bsp_display_unlock(void)
+{
+    lvgl_port_unlock();
+}
+
+#if CONFIG_BSP_DISPLAY_HW_ROTATION
+/* Same MADCTL table as the target, there is no touch controller to remap */
+static const struct {
+    bool swap_xy;
+    bool mirror_x;
+    bool mirror_y;
+} bsp_host_orient[] = {
+    [LV_DISP_ROT_NONE] = { .swap_xy = false, .mirror_x = true,  .mirror_y = false },
+    [LV_DISP_ROT_90]   = { .swap_xy = true,  .mirror_x = true,  .mirror_y = true  },
+    [LV_DISP_ROT_180]  = { .swap_xy = false, .mirror_x = false, .mirror_y = true  },
+    [LV_DISP_ROT_270]  = { .swap_xy = true,  .mirror_x = false, .mirror_y = false },
+};
+#endif
+
+void bsp_display_rotate(lv_disp_t *disp, lv_disp_rot_t rotation)
+{
+#if CONFIG_BSP_DISPLAY_HW_ROTATION
+    if (rotation > LV_DISP_ROT_270) {
+        ESP_LOGE(TAG, "Invalid rotation %d", rotation);
+        return;
+    }
+    /* Like the target: LVGL renders the rotated resolution unrotated and the panel swaps the axes */
+    const bool swap_xy = bsp_host_orient[rotation].swap_xy;
+
+    bsp_display_lock(0);
+    disp->driver->sw_rotate = 0;
+    disp->driver->rotated = LV_DISP_ROT_NONE;
+    disp->driver->hor_res = swap_xy ? BSP_LCD_V_RES : BSP_LCD_H_RES;
+    disp->driver->ver_res = swap_xy ? BSP_LCD_H_RES : BSP_LCD_V_RES;
+    esp_lcd_panel_swap_xy(disp_panel, swap_xy);
+    esp_lcd_panel_mirror(disp_panel, bsp_host_orient[rotation].mirror_x, bsp_host_orient[rotation].mirror_y);
+    lv_disp_drv_update(disp, disp->driver);
+    bsp_display_unlock();
+#else
+    lv_disp_set_rotation(disp, rotation);
+#endif
+}
+
+esp_lcd_panel_io_handle_t bsp_host_display_get_io(void)
+{
+    return disp_io;
+}
+
+void bsp_host_touch_set(bool pressed, lv_coord_t x, lv_coord_t y)
+{
+    s_touch.pressed = pressed;
+    s_touch.x = x;
+    s_touch.y = y;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdbool.h>
+#include "esp_lcd_panel_io.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************************************************************************
+ *
+ * Host build of the BSP
+ *
+ * bsp_display_start() registers the LVGL display with the BSP flush path and draw kernels on top
+ * of the esp_lcd mock instead of the i80 bus. There is no LVGL task: the application advances
+ * lv_tick and calls lv_timer_handler() itself, so every frame can be timed.
+ *
+ **************************************************************************************************/
+
+/**
+ * @brief Get mock panel IO of the display
+ *
+ * Use it with esp_lcd_panel_io_mock_get_stats() and esp_lcd_panel_io_mock_get_gram().
+ *
+ * @return Panel IO handle or NULL when bsp_display_start() was not called
+ */
+esp_lcd_panel_io_handle_t bsp_host_display_get_io(void);
+
+/**
+ * @brief Set state of the simulated touch panel
+ *
+ * The next LVGL input read returns this state, like a read of the FT5x06 would.
+ *
+ * @param[in] pressed Touch is pressed
+ * @param[in] x       X coordinate of the touch in LVGL display coordinates
+ * @param[in] y       Y coordinate of the touch in LVGL display coordinates
+ */
+void bsp_host_touch_set(bool pressed, lv_coord_t x, lv_coord_t y);
+
+#ifdef __cplusplus
+}
+#endif
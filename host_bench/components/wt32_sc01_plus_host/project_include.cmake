@@ -0,0 +1,2 @@
+# Same image conversion as the firmware build
+include(${CMAKE_CURRENT_LIST_DIR}/../../../components/wt32_sc01_plus/cmake/bsp_images.cmake)
@@ -0,0 +1,134 @@
+/*
+ * Headless run of the demo UI on the BSP display path with a mock panel.
+ *
+ * Reports render time per frame, frames per second and bytes pushed to the panel, so flush and
+ * rendering changes can be compared without a board.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "bsp/esp-bsp.h"
+#include "bsp_host.h"
+#include "esp_lcd_mock.h"
+
+#include "lvgl_demo_ui.h"
+
+static const char *TAG = "host_bench";
+
+/* Center of the "SHOW AGAIN" button, aligned to the bottom left corner by the demo */
+#define TAP_X                   (60)
+#define TAP_Y(disp)             (lv_disp_get_ver_res(disp) - 45)
+#define TAP_LENGTH              (3)     // Refresh periods the simulated finger stays down
+
+static int cmp_u32(const void *a, const void *b)
+{
+    const uint32_t x = *(const uint32_t *)a;
+    const uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void simulate_touch(lv_disp_t *disp, uint32_t tick)
+{
+#if CONFIG_HOST_BENCH_TAP_PERIOD
+    const uint32_t phase = tick % CONFIG_HOST_BENCH_TAP_PERIOD;
+    if (phase == 0) {
+        bsp_host_touch_set(true, TAP_X, TAP_Y(disp));
+    } else if (phase == TAP_LENGTH) {
+        bsp_host_touch_set(false, TAP_X, TAP_Y(disp));
+    }
+#endif
+}
+
+void app_main(void)
+{
+    lv_disp_t *disp = bsp_display_start();
+    if (disp == NULL) {
+        ESP_LOGE(TAG, "Display start failed");
+        exit(2);
+    }
+    bsp_display_rotate(disp, LV_DISP_ROT_270);
+
+    bsp_display_lock(0);
+    esp_lvgl_demo_ui(disp);
+    bsp_display_unlock();
+
+    esp_lcd_panel_io_handle_t io = bsp_host_display_get_io();
+    esp_lcd_panel_io_mock_reset_stats(io);
+    bsp_display_flush_reset_stats();
+
+    uint32_t *render_us = malloc(CONFIG_HOST_BENCH_TICKS * sizeof(uint32_t));
+    if (render_us == NULL) {
+        ESP_LOGE(TAG, "No memory for %d samples", CONFIG_HOST_BENCH_TICKS);
+        exit(2);
+    }
+
+    uint32_t frames = 0;
+    uint64_t render_total_us = 0;
+    uint32_t color_trans = 0;
+    for (uint32_t tick = 0; tick < CONFIG_HOST_BENCH_TICKS; tick++) {
+        simulate_touch(disp, tick);
+        lv_tick_inc(LV_DISP_DEF_REFR_PERIOD);
+
+        bsp_display_lock(0);
+        const int64_t start = esp_timer_get_time();
+        lv_timer_handler();
+        const uint32_t elapsed = esp_timer_get_time() - start;
+        bsp_display_unlock();
+
+        /* Only periods that sent pixels to the panel are frames */
+        esp_lcd_panel_io_mock_stats_t stats;
+        esp_lcd_panel_io_mock_get_stats(io, &stats);
+        if (stats.color_trans != color_trans) {
+            color_trans = stats.color_trans;
+            render_us[frames++] = elapsed;
+            render_total_us += elapsed;
+        }
+    }
+
+    esp_lcd_panel_io_mock_stats_t stats;
+    esp_lcd_panel_io_mock_get_stats(io, &stats);
+    bsp_display_flush_stats_t flush_stats;
+    bsp_display_flush_get_stats(&flush_stats);
+
+    if (frames == 0) {
+        ESP_LOGE(TAG, "No frame was rendered in %d refresh periods", CONFIG_HOST_BENCH_TICKS);
+        exit(1);
+    }
+
+    qsort(render_us, frames, sizeof(uint32_t), cmp_u32);
+    const float render_fps = frames * 1000000.0f / render_total_us;
+    const float bus_fps = stats.bus_time_us ? frames * 1000000.0f / stats.bus_time_us : 0.0f;
+
+    ESP_LOGI(TAG, "Frames            : %" PRIu32 " in %d refresh periods of %d ms", frames, CONFIG_HOST_BENCH_TICKS,
+             LV_DISP_DEF_REFR_PERIOD);
+    ESP_LOGI(TAG, "Render time [us]  : min %" PRIu32 ", avg %" PRIu64 ", p50 %" PRIu32 ", p95 %" PRIu32 ", max %" PRIu32,
+             render_us[0], render_total_us / frames, render_us[frames / 2], render_us[frames * 95 / 100],
+             render_us[frames - 1]);
+    ESP_LOGI(TAG, "Render rate       : %.1f fps (host CPU)", render_fps);
+    ESP_LOGI(TAG, "Pushed to panel   : %" PRIu64 " color bytes, %" PRIu64 " command bytes, %" PRIu32 " transfers",
+             stats.color_bytes, stats.cmd_bytes, stats.color_trans);
+    ESP_LOGI(TAG, "Bus time          : %" PRIu64 " us at %d kHz, %.1f fps bus bound", stats.bus_time_us,
+             CONFIG_BSP_LCD_PIXEL_CLOCK_KHZ, bus_fps);
+    ESP_LOGI(TAG, "Areas             : %" PRIu32 " invalidated, %" PRIu32 " flushed", flush_stats.areas_in,
+             flush_stats.areas_out);
+
+    /* One line for CI scripts */
+    printf("HOST_BENCH frames=%" PRIu32 " render_fps=%.1f render_avg_us=%" PRIu64 " render_p95_us=%" PRIu32
+           " color_bytes=%" PRIu64 " cmd_bytes=%" PRIu64 " transfers=%" PRIu32 " bus_fps=%.1f\n",
+           frames, render_fps, render_total_us / frames, render_us[frames * 95 / 100], stats.color_bytes,
+           stats.cmd_bytes, stats.color_trans, bus_fps);
+    fflush(stdout);
+    free(render_us);
+
+#if CONFIG_HOST_BENCH_MIN_FPS
+    if (render_fps < CONFIG_HOST_BENCH_MIN_FPS) {
+        ESP_LOGE(TAG, "Render rate %.1f fps is below the minimum of %d fps", render_fps, CONFIG_HOST_BENCH_MIN_FPS);
+        exit(1);
+    }
+#endif
+    exit(0);
+}
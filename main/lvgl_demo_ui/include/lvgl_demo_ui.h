@@ -1,8 +1,21 @@
 #ifndef LVGL_DEMO_UI_H__
 #define LVGL_DEMO_UI_H__
 
+#include "sdkconfig.h"
 #include "lvgl.h"
 
 void esp_lvgl_demo_ui(lv_disp_t *disp);
 
+#if CONFIG_BSP_AUDIO_SFX
+#include "bsp/esp-bsp.h"
+
+/* Effect played when the button is clicked */
+void esp_lvgl_demo_ui_set_click_sfx(bsp_audio_sfx_t sfx);
+#endif
+
+#if CONFIG_BSP_FONT
+/* Font of the button label */
+void esp_lvgl_demo_ui_set_font(const lv_font_t *font);
+#endif
+
 #endif // LVGL_DEMO_UI_H__
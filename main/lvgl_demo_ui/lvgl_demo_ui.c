@@ -14,8 +14,23 @@
 #endif
 
 // LVGL image declare
+#if CONFIG_BSP_ASSETS
+/* Images are mapped from the assets partition */
+#include "bsp/esp-bsp.h"
+#define DEMO_IMG_LOGO   bsp_assets_get_img("esp_logo")
+#define DEMO_IMG_TEXT   bsp_assets_get_img("esp_text")
+#elif CONFIG_BSP_IMG_RLE
+/* RLE compressed versions, decoded by the BSP */
+LV_IMG_DECLARE(esp_logo_rle)
+LV_IMG_DECLARE(esp_text_rle)
+#define DEMO_IMG_LOGO   (&esp_logo_rle)
+#define DEMO_IMG_TEXT   (&esp_text_rle)
+#else
 LV_IMG_DECLARE(esp_logo)
 LV_IMG_DECLARE(esp_text)
+#define DEMO_IMG_LOGO   (&esp_logo)
+#define DEMO_IMG_TEXT   (&esp_text)
+#endif
 
 typedef struct {
     lv_obj_t *scr;
@@ -24,6 +39,7 @@ typedef struct {
 
 static my_timer_context_t my_tim_ctx;
 static lv_obj_t * btn;
+static lv_obj_t *btn_lbl;
 static lv_obj_t *arc[3];
 static lv_obj_t *img_logo;
 static lv_obj_t *img_text = NULL;
@@ -59,7 +75,7 @@ static void anim_timer_cb(lv_timer_t *timer)
 
         // Create new image and make it transparent
         img_text = lv_img_create(scr);
-        lv_img_set_src(img_text, &esp_text);
+        lv_img_set_src(img_text, DEMO_IMG_TEXT);
         lv_obj_set_style_img_opa(img_text, 0, 0);
     }
 
@@ -119,9 +135,31 @@ static void start_animation(lv_obj_t *scr)
     lv_obj_add_state(btn, LV_STATE_DISABLED);
 }
 
+#if CONFIG_BSP_AUDIO_SFX
+static bsp_audio_sfx_t click_sfx = BSP_AUDIO_SFX_NONE;
+
+void esp_lvgl_demo_ui_set_click_sfx(bsp_audio_sfx_t sfx)
+{
+    click_sfx = sfx;
+}
+#endif
+
+#if CONFIG_BSP_FONT
+void esp_lvgl_demo_ui_set_font(const lv_font_t *font)
+{
+    if (btn_lbl) {
+        lv_obj_set_style_text_font(btn_lbl, font, 0);
+    }
+}
+#endif
+
 static void btn_cb(lv_event_t * e)
 {
     lv_obj_t * scr = lv_event_get_user_data(e);
+#if CONFIG_BSP_AUDIO_SFX
+    /* Only queues a trigger, the effect is already decoded in RAM */
+    bsp_audio_sfx_play(click_sfx, 100);
+#endif
     start_animation(scr);
 }
 
@@ -131,12 +169,12 @@ void esp_lvgl_demo_ui(lv_disp_t *disp)
 
     // Create image
     img_logo = lv_img_create(scr);
-    lv_img_set_src(img_logo, &esp_logo);
+    lv_img_set_src(img_logo, DEMO_IMG_LOGO);
 
     btn = lv_btn_create(scr);
-    lv_obj_t * lbl = lv_label_create(btn);
-    lv_label_set_text_static(lbl, LV_SYMBOL_REFRESH" SHOW AGAIN");
-    lv_obj_set_style_text_font(lbl, &lv_font_montserrat_20, 0);
+    btn_lbl = lv_label_create(btn);
+    lv_label_set_text_static(btn_lbl, LV_SYMBOL_REFRESH" SHOW AGAIN");
+    lv_obj_set_style_text_font(btn_lbl, &lv_font_montserrat_20, 0);
     lv_obj_align(btn, LV_ALIGN_BOTTOM_LEFT, 20, -20);
     // Button event
     lv_obj_add_event_cb(btn, btn_cb, LV_EVENT_CLICKED, scr);
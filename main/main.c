@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+#include <inttypes.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
@@ -16,16 +17,95 @@
 
 static const char *TAG = "app_main";
 
-#define LOG_MEM_INFO    (0)
+#if CONFIG_BSP_DISPLAY_SPLASH
+/* Converted from esp_logo.png by bsp_add_images(SPLASH) */
+extern const bsp_display_splash_t esp_logo_splash;
+#endif
+
+#if CONFIG_BSP_IMG_RLE_BENCHMARK
+LV_IMG_DECLARE(esp_logo)
+LV_IMG_DECLARE(esp_logo_rle)
+LV_IMG_DECLARE(esp_text)
+LV_IMG_DECLARE(esp_text_rle)
+#endif
+
+/* The LVGL benchmark would count the comparison in its scene times, it runs with the custom demo only */
+#if CONFIG_BSP_DISPLAY_DUAL_CORE && !CONFIG_LV_USE_DEMO_WIDGETS && !CONFIG_LV_USE_DEMO_MUSIC && \
+    !CONFIG_LV_USE_DEMO_STRESS && !CONFIG_LV_USE_DEMO_BENCHMARK
+#define DUAL_CORE_COMPARE               (1)
+#define DUAL_CORE_COMPARE_PERIOD_MS     (250)
+#define DUAL_CORE_COMPARE_FRAMES        (10)
+#define DUAL_CORE_COMPARE_COUNT         (20)
+
+/* Compare rendering on one and both cores on the demo screen as it animates */
+static void dual_core_compare(lv_disp_t *disp)
+{
+    uint64_t single_total_us = 0;
+    uint64_t dual_total_us = 0;
+    for (int i = 0; i < DUAL_CORE_COMPARE_COUNT; i++) {
+        uint32_t single_us, dual_us;
+        if (bsp_display_dual_core_compare(disp, DUAL_CORE_COMPARE_FRAMES, &single_us, &dual_us) != ESP_OK) {
+            return;
+        }
+        single_total_us += single_us;
+        dual_total_us += dual_us;
+        vTaskDelay(pdMS_TO_TICKS(DUAL_CORE_COMPARE_PERIOD_MS));
+    }
+    ESP_LOGI(TAG, "Dual-core rendering is %.2fx as fast as single-core over %d samples",
+             (float)single_total_us / dual_total_us, DUAL_CORE_COMPARE_COUNT);
+}
+#endif
+
+#if CONFIG_BSP_SD_IO
+static void sd_io_flush_cb(esp_err_t result, size_t size, void *user_ctx)
+{
+    bsp_sd_io_stats_t stats;
+    bsp_sd_io_get_stats(&stats);
+    ESP_LOGI(TAG, "uSD flush %s, %" PRIu32 " requests, %" PRIu32 " us max latency", esp_err_to_name(result),
+             stats.requests, stats.latency_us_max);
+}
+#endif
 
 void app_main(void)
 {
     lv_disp_t * disp;
+#if CONFIG_BSP_HEAP_TELEMETRY
+    /* Heap usage and fragmentation are sampled and logged in the background */
+    bsp_heap_telemetry_start();
+#endif
+#if CONFIG_BSP_BOOT_TIMING
+    int phase = bsp_boot_phase_begin("i2c");
     bsp_i2c_init();
+    bsp_boot_phase_end(phase);
+#else
+    bsp_i2c_init();
+#endif
+
+    /* Card detection and FAT mount run in the background while the display comes up */
+    bsp_sdcard_mount_async();
+
+#if CONFIG_BSP_DISPLAY_BENCHMARK
+    /* Sweep pixel clocks reachable from the 160 MHz PLL, before LVGL takes over the bus */
+    const uint32_t pclk_hz[] = { 10000000, 16000000, 20000000, 26666666, 32000000, 40000000 };
+    bsp_display_benchmark(pclk_hz, sizeof(pclk_hz) / sizeof(pclk_hz[0]), NULL);
+#endif
+
+#if CONFIG_BSP_DISPLAY_SPLASH
+    bsp_display_set_splash(&esp_logo_splash);
+#endif
     disp = bsp_display_start();
 
     bsp_display_rotate(disp, LV_DISP_ROT_270);
 
+#if CONFIG_BSP_IMG_RLE_BENCHMARK
+    /* Draw time of the demo images, raw and RLE compressed */
+    const bsp_img_rle_bench_image_t bench_images[] = {
+        { .name = "esp_logo", .raw = &esp_logo, .rle = &esp_logo_rle },
+        { .name = "esp_text", .raw = &esp_text, .rle = &esp_text_rle },
+    };
+    bsp_img_rle_benchmark(bench_images, sizeof(bench_images) / sizeof(bench_images[0]), NULL);
+#endif
+
 #if CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
     ESP_LOGI(TAG, "Avoid lcd tearing effect");
 #if CONFIG_BSP_DISPLAY_LVGL_FULL_REFRESH
@@ -36,6 +116,9 @@ void app_main(void)
 #endif
 
     ESP_LOGI(TAG, "Display LVGL demo");
+#if CONFIG_BSP_BOOT_TIMING
+    phase = bsp_boot_phase_begin("ui");
+#endif
     bsp_display_lock(0);
 #if CONFIG_LV_USE_DEMO_WIDGETS
     lv_demo_widgets();      /* A widgets example */
@@ -49,33 +132,71 @@ void app_main(void)
     esp_lvgl_demo_ui(disp); /* A custom demo from espressif */
 #endif
 
+#if CONFIG_BSP_BOOT_TIMING
+    bsp_boot_phase_end(phase);
+    /* Render the first LVGL frame now instead of on the next refresh period */
+    phase = bsp_boot_phase_begin("first frame");
+    lv_refr_now(disp);
+    bsp_boot_phase_end(phase);
+#endif
     bsp_display_unlock();
     bsp_display_brightness_set(20);
 
-    // Mount uSD card
-    if (ESP_OK == bsp_sdcard_mount()) {
+    // Wait for the uSD card mounted in the background
+    if (ESP_OK == bsp_sdcard_mount_wait(0)) {
         sdmmc_card_print_info(stdout, bsp_sdcard);
+#if CONFIG_BSP_SD_BENCHMARK
+        /* Dividers of the 80 MHz SPI clock up to the GPIO matrix limit, 20 MHz is the default */
+        const uint32_t sd_freq_khz[] = { 10000, 20000, 26666, 40000 };
+        bsp_sdcard_benchmark(sd_freq_khz, sizeof(sd_freq_khz) / sizeof(sd_freq_khz[0]), NULL);
+#endif
+#if CONFIG_BSP_SD_LOG_BENCHMARK
+        bsp_sd_log_benchmark(NULL);
+#endif
+#if CONFIG_BSP_SD_IO
+        /* Written by the storage task, the card stays mounted for it */
+        if (ESP_OK == bsp_sd_io_start()) {
+            char hello[32];
+            const int len = snprintf(hello, sizeof(hello), "Hello %s!\n", bsp_sdcard->cid.name);
+            bsp_sd_io_truncate(BSP_MOUNT_POINT "/hello.txt", NULL, NULL);
+            bsp_sd_io_write(BSP_MOUNT_POINT "/hello.txt", hello, len, NULL, NULL);
+            bsp_sd_io_flush(sd_io_flush_cb, NULL);
+        }
+#else
         FILE *f = fopen(BSP_MOUNT_POINT "/hello.txt", "w");
         fprintf(f, "Hello %s!\n", bsp_sdcard->cid.name);
         fclose(f);
+#if !CONFIG_BSP_AUDIO && !CONFIG_BSP_FONT
         bsp_sdcard_unmount();
+#endif
+#endif
+#if CONFIG_BSP_AUDIO
+        /* Streamed from the card while the demo runs, the card stays mounted for it */
+        if (ESP_OK == bsp_audio_init()) {
+#if CONFIG_BSP_AUDIO_SFX
+            bsp_audio_sfx_t click;
+            if (ESP_OK == bsp_audio_sfx_load(BSP_MOUNT_POINT "/click.wav", &click)) {
+                esp_lvgl_demo_ui_set_click_sfx(click);
+            }
+#endif
+            bsp_audio_play(BSP_MOUNT_POINT "/music.wav", true);
+        }
+#endif
+#if CONFIG_BSP_FONT
+        /* Preloaded when it fits CONFIG_BSP_FONT_PRELOAD_KB, else glyphs are read from the card when drawn */
+        lv_font_t *font = bsp_font_load(BSP_MOUNT_POINT "/font.bin");
+        if (font) {
+            font->fallback = &lv_font_montserrat_20;    // LV_SYMBOL_REFRESH on the button
+            bsp_display_lock(0);
+            esp_lvgl_demo_ui_set_font(font);
+            bsp_display_unlock();
+        }
+#endif
     }
-
-#if LOG_MEM_INFO
-    static char buffer[128];    /* Make sure buffer is enough for `sprintf` */
-    while (1) {
-        sprintf(buffer, "   Biggest /     Free /    Total\n"
-                "\t  SRAM : [%8d / %8d / %8d]\n"
-                "\t PSRAM : [%8d / %8d / %8d]",
-                heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL),
-                heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
-                heap_caps_get_total_size(MALLOC_CAP_INTERNAL),
-                heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM),
-                heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
-                heap_caps_get_total_size(MALLOC_CAP_SPIRAM));
-        ESP_LOGI("MEM", "%s", buffer);
-
-        vTaskDelay(pdMS_TO_TICKS(500));
-    }
+#if CONFIG_BSP_BOOT_TIMING
+    bsp_boot_report();
+#endif
+#if DUAL_CORE_COMPARE
+    dual_core_compare(disp);
 #endif
 }